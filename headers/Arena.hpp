@@ -0,0 +1,182 @@
+#ifndef Arena_hpp
+#define Arena_hpp
+#include "Ball.hpp"
+#include "BallPool.hpp"
+#include "BlockField.hpp"
+#include "Enums.hpp"
+#include "EventQueue.hpp"
+#include "FrameSnapshot.hpp"
+#include "LevelData.hpp"
+#include "Paddle.hpp"
+#include "RandNum.hpp"
+#include "SideWall.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// dimensions (pixels) of the game area and of the objects placed in it.
+// The defaults correspond to the window and image assets used by the game
+struct ArenaLayout
+{
+  // size of the game area
+  float width = 1024.0f;
+  float height = 768.0f;
+  // tickness of the walls limiting the game area
+  float wall_tickness = 12.0f;
+  // size of the paddle
+  float paddle_width = 100.0f;
+  float paddle_height = 10.0f;
+  // radius of the ball
+  float ball_radius = 8.0f;
+};
+
+// interface for objects interested in the events happening in the arena
+class ArenaListener
+{
+  public:
+  // virtual destructor for handling inheritence
+  virtual ~ArenaListener() = default;
+  // called once per frame for every kind of game event which happened in the
+  // arena since the previous frame
+  virtual void OnEvent(const EventRecord& event) = 0;
+};
+
+// The core of the game, independent of SDL: the game area with the walls,
+// the blocks, the paddle and the balls, together with the rules of the game
+// (scoring, lives and levels). Destroying a silver block splits the ball
+// which hit it in two; a life is lost only when the last ball leaves
+// the screen. The game events are recorded during the simulation and passed
+// on to the listener in a batch, when the driver of the arena asks for it.
+// It can be driven by the SDL front-end
+// (the Game class) or run without any display or audio at all.
+class Arena
+{
+  public:
+  // Constructor. Takes the dimensions of the game area and its objects,
+  // the path to the level files, the number of levels implemented, the
+  // seed of the random numbers used in the game (the same seed and the same
+  // input give the same game) and the asset pack the level files are read
+  // from (NOT OWNED; the files are read from the disk if it's nullptr or
+  // doesn't contain them). Loads the first level. Throws
+  // std::runtime_error if unable to load level data and std::invalid_argument
+  // if the layout doesn't allow to create the game objects
+  Arena(const ArenaLayout& layout, const std::string& levelsPath,
+      unsigned levelsImplemented, std::uint64_t seed,
+      const AssetPack* assets = nullptr);
+
+  // the game objects refer to each other, so copy operations are disabled
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // sets the object notified about game events; nullptr disables notifying
+  void SetListener(ArenaListener* listener) { listener_ = listener; }
+  // Awards the points for the events recorded since the previous call and
+  // passes the records on to the listener. To be called once per frame,
+  // after the simulation steps
+  void DispatchEvents();
+
+  // updates the state of the paddle and the balls by the given time (seconds)
+  void Update(float deltaTime);
+  // Returns the time (seconds) until the next predicted contact of any ball
+  // with a wall, a block or the paddle. As long as the paddle keeps its
+  // velocity, a single update that long misses no contact, so it may replace
+  // many short ones. The game only approximates the one of the short updates,
+  // as the positions are rounded differently
+  float TimeToNextEvent() { return balls_->TimeToNextEvent(); }
+  // Loads new level. Returns true if new level loaded successfully,
+  // false if the requested level is not implemented
+  bool LoadLevel(unsigned newLevel);
+  // starts the game from the first level with no points
+  void Restart();
+  // steers the paddle and the balls as the player commands
+  void HandleCommand(PlayerCommand command);
+  // copies everything displayed from the game area into the snapshot
+  void Capture(FrameSnapshot& snapshot) const;
+
+  // handles a block (given by its index) being hit by the given ball
+  void HandleBlockHit(std::size_t blockIndex, const Ball& ball);
+  // records the game event awarding the given points; the points are added
+  // and the listener is notified by DispatchEvents()
+  void Post(GameEvent event, unsigned points = 0)
+  {
+    events_.Push(event, points);
+  }
+
+  // returns the paddle
+  Paddle& GetPaddle() { return *paddle_; }
+  const Paddle& GetPaddle() const { return *paddle_; }
+  // returns the balls in play
+  BallPool& Balls() { return *balls_; }
+  const BallPool& Balls() const { return *balls_; }
+  // returns the blocks of the current level
+  const BlockField& Blocks() const { return blocks_; }
+  // returns the walls limiting the game area
+  const std::vector<SideWall>& Walls() const { return side_walls_; }
+  // returns dimensions of the game area and its objects
+  const ArenaLayout& Layout() const { return layout_; }
+  // returns the events recorded since the last DispatchEvents() call
+  const EventQueue& Events() const { return events_; }
+  // returns the stream of random numbers used in the game
+  gMath::RandNum& Random() { return random_; }
+
+  // returns the current level number
+  unsigned Level() const { return level_data_->Level(); }
+  // returns points achieved by the player
+  unsigned TotalPoints() const { return total_points_; }
+  // returns number of remaining lives (balls) before "game over"
+  unsigned BallsRemaining() const { return balls_remaining_; }
+  // checks if all the blocks of the current level have been destroyed
+  bool IsLevelCleared() const { return blocks_.LiveCount() == 0; }
+  // checks if the player has lost all the balls
+  bool IsLost() const { return balls_remaining_ == 0; }
+  private:
+  // creates the walls limiting the game area
+  void CreateWalls();
+  // creates blocks for the current level
+  void CreateBlocks();
+  // puts the paddle and the ball in the starting position for the level
+  void ResetPaddleAndBall();
+  // handles the last ball leaving the allowed screen area
+  void HandleBallEscape();
+  // checks if the paddle can move up without outrunning any of the balls
+  bool CanPaddleMoveUp() const;
+
+  // dimensions of the game area and its objects
+  const ArenaLayout layout_;
+  // path to the directory with level files
+  const std::string levels_path_;
+  // NOT OWNED pointer to the asset pack with the level files; may be nullptr
+  const AssetPack* assets_;
+  // number levels implemented by the developer
+  const unsigned max_level_;
+  // speed increase applied when the user orders so
+  const float speed_increment_ = 30.0f;
+  // speed decrease applied when the user orders so
+  const float speed_decrement_ = 25.0f;
+  // maximum number of balls in play at the same time
+  static constexpr std::size_t max_balls = 32;
+  // inlcudes all the current level data
+  std::unique_ptr<LevelData> level_data_;
+  // container for side walls
+  std::vector<SideWall> side_walls_;
+  // container of all the blocks in the current level
+  BlockField blocks_;
+  // pointer to the paddle
+  std::unique_ptr<Paddle> paddle_;
+  // pointer to the container of the balls in play
+  std::unique_ptr<BallPool> balls_;
+  // takes track of points achieved by the player
+  unsigned total_points_ = 0;
+  // number of remaining lives (balls) before "game over"
+  unsigned balls_remaining_;
+  // stream of random numbers used in the game
+  gMath::RandNum random_;
+  // game events waiting to be passed on to the listener
+  EventQueue events_;
+  // NOT OWNED pointer to the object notified about game events
+  ArenaListener* listener_ = nullptr;
+};
+
+#endif // !Arena_hpp
@@ -0,0 +1,84 @@
+#ifndef ArenaView_HPP
+#define ArenaView_HPP
+#include "Arena.hpp"
+#include "DrawList.hpp"
+#include "Enums.hpp"
+#include "FrameSnapshot.hpp"
+#include "SpriteAtlas.hpp"
+#include "Vector2d.hpp"
+#include <bitset>
+#include <functional>
+#include <memory>
+
+// Displayable representation of the game area. The game objects of the Arena
+// know nothing about SDL, so this class draws all of them (walls, blocks not
+// yet destroyed, the paddle and the balls) with the regions of the sprite
+// atlas corresponding to their sprites. The walls and blocks change rarely, so
+// they are drawn once into an off-screen layer and only the blocks destroyed
+// since the previous frame are erased from it; every frame the layer is copied
+// to the screen and the paddle and the balls are drawn on top of it, at
+// sub-pixel positions interpolated between the last two simulation steps. The
+// blocks, the paddle and the balls are read from a snapshot of the arena, so
+// the arena itself may be updated meanwhile; only its layout and walls, which
+// never change, are read directly.
+class ArenaView
+{
+  public:
+  // Constructor. Takes the arena to be displayed, the atlas with the sprites
+  // used in the game and the renderer used for drawing. Throws
+  // std::invalid_argument if any of the sprites displayed in the arena is
+  // missing in the atlas and SDLexception if creating the layer fails
+  ArenaView(const Arena& arena, const SpriteAtlas& atlas,
+      SDL_Renderer* gameRenderer);
+
+  // copying of class not predicted due to use of unique_ptr and no overall
+  // sense of copying, so copy operations are disabled
+  ArenaView(const ArenaView&) = delete;
+  ArenaView& operator=(const ArenaView&) = delete;
+
+  // adds the commands displaying the game area captured in the snapshot to the
+  // draw list; the paddle and the balls are displayed at the given part
+  // (alpha, 0 to 1) of the way from their previous to their current positions
+  void Draw(
+      DrawList& drawList, const FrameSnapshot& snapshot, float alpha) const;
+  // forces redrawing the layer of walls and blocks, e.g. after the contents
+  // of render targets were lost
+  void InvalidateLayer() { layer_valid_ = false; }
+
+  private:
+  // brings the layer of walls and blocks up to date with the snapshot
+  void UpdateLayer(const FrameSnapshot& snapshot) const;
+  // draws all the walls and the blocks of the snapshot not yet destroyed into
+  // the layer
+  void RedrawLayer(const FrameSnapshot& snapshot) const;
+  // adds the command drawing the sprite centred at the given position into
+  // the layer, aligned to whole pixels
+  void DrawLayerSprite(Sprite sprite, const gMath::Vector2d& position) const;
+  // adds the command displaying the movable sprite centred at the given
+  // position to the draw list, at a sub-pixel position
+  void DrawMovableSprite(DrawList& drawList, Sprite sprite,
+      const gMath::Vector2d& position) const;
+  // returns the rectangle covered by the sprite centred at the given
+  // position, aligned to whole pixels
+  SDL_Rect Destination(Sprite sprite, const gMath::Vector2d& position) const;
+
+  // the game area to be displayed
+  const Arena& arena_;
+  // NOT OWNED pointer to SDL renderer
+  SDL_Renderer* sdl_renderer_;
+  // the atlas with the sprites
+  const SpriteAtlas& atlas_;
+  // the commands drawing the walls and blocks into the layer; refilled by
+  // every redraw of the layer
+  mutable DrawList layer_commands_;
+  // screen-sized target texture with the walls and the blocks; unique pointer
+  // with custom deleter
+  std::unique_ptr<SDL_Texture, std::function<void(SDL_Texture*)>> layer_;
+  // indicates if the layer contents can be used
+  mutable bool layer_valid_ = false;
+  // generation of the blocks drawn in the layer
+  mutable unsigned layer_generation_ = 0;
+  // flags of the blocks present in the layer
+  mutable std::bitset<FrameSnapshot::max_blocks> layer_alive_;
+};
+#endif // !ArenaView_HPP
@@ -0,0 +1,47 @@
+#ifndef AssetLoader_HPP
+#define AssetLoader_HPP
+#include "AssetPack.hpp"
+#include "SDL.h"
+#include <functional>
+#include <memory>
+#include <string>
+
+// Opens the assets of the game for the SDL libraries. If the asset pack
+// exists, it is mapped once and every asset found in it is read straight from
+// the mapped memory (through SDL_RWops over memory, or as pixels of an image
+// decoded in advance); the assets missing in the pack, or all of them if there
+// is no pack, are read from their files. All the methods are const and can be
+// called from any thread.
+class AssetLoader
+{
+  public:
+  // pointer to SDL_Surface with custom deleter
+  using SurfacePtr
+      = std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface*)>>;
+
+  // Constructor. Takes the path of the asset pack. Throws std::runtime_error
+  // if the pack exists but can't be mapped or is not valid
+  explicit AssetLoader(const std::string& packPath);
+
+  // the mapped pack is owned by the object, so copy operations are disabled
+  AssetLoader(const AssetLoader&) = delete;
+  AssetLoader& operator=(const AssetLoader&) = delete;
+
+  // returns the mapped asset pack, or nullptr if there is none
+  const AssetPack* Pack() const { return pack_.get(); }
+  // Returns a new stream reading the asset with the given path; to be closed
+  // by the caller (e.g. passed to a loading function closing it). Throws
+  // SDLexception if the asset can't be opened
+  SDL_RWops* Open(const std::string& path) const;
+  // Returns the image with the given path in the RGBA32 pixel format. An
+  // image decoded in advance is not copied: the surface uses the mapped
+  // pixels and must only be read. Throws SDLexception if loading or
+  // converting the image fails
+  SurfacePtr LoadImage(const std::string& path) const;
+
+  private:
+  // the mapped asset pack; empty if there is no pack
+  std::unique_ptr<AssetPack> pack_;
+};
+
+#endif // !AssetLoader_HPP
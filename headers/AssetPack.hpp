@@ -0,0 +1,80 @@
+#ifndef AssetPack_hpp
+#define AssetPack_hpp
+#include "Enums.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// an asset stored in the asset pack
+struct AssetEntry
+{
+  // the bytes of the asset within the mapped pack
+  std::string_view data;
+  // how the asset is stored
+  AssetKind kind = AssetKind::File;
+  // size of the image (RgbaImage assets only)
+  unsigned width = 0;
+  unsigned height = 0;
+};
+
+// A read-only archive with all the assets of the game in a single file,
+// memory-mapped at construction. The assets are found by their paths relative
+// to the assets directory and returned as views of the mapped memory, so
+// loading them costs neither opening files nor copying them. The file starts
+// with the magic and the number of the entries, followed by the index (for
+// every asset: the lengths of its name, its kind, image size, offset and
+// size) and the data of the assets aligned to 16 bytes. All the numbers are
+// little-endian.
+class AssetPack
+{
+  public:
+  // the first bytes of every asset pack
+  static constexpr std::string_view magic { "ARKPACK1" };
+  // alignment (bytes) of the data of every asset within the file
+  static constexpr std::size_t alignment = 16;
+  // size (bytes) of an index entry without the name
+  static constexpr std::size_t index_entry_size = 4 * 4 + 2 * 8;
+
+  // Constructor. Takes the path of the pack and the path of the assets
+  // directory the looked up paths start with. Throws std::runtime_error if
+  // the pack can't be opened or mapped or if its contents are not valid
+  AssetPack(const std::string& packPath, std::string assetsRoot);
+  // Destructor. Unmaps the pack; the views of the assets become invalid
+  ~AssetPack();
+
+  // the mapped memory is owned by the object, so copy operations are disabled
+  AssetPack(const AssetPack&) = delete;
+  AssetPack& operator=(const AssetPack&) = delete;
+
+  // returns the asset with the given path (starting with the assets root or
+  // relative to it), or nullptr if the pack doesn't contain it
+  const AssetEntry* Find(std::string_view path) const;
+  // returns the number of assets in the pack
+  std::size_t Size() const { return entries_.size(); }
+
+  private:
+  // maps the whole file into memory; throws std::runtime_error on failure
+  void Map(const std::string& packPath);
+  // releases the mapping and the handles of the file, if any
+  void Unmap();
+  // reads the index of the assets; throws std::runtime_error if it isn't
+  // valid
+  void ReadIndex(const std::string& packPath);
+
+  // path of the assets directory stripped from the looked up paths
+  const std::string assets_root_;
+  // the mapped file
+  const char* data_ = nullptr;
+  std::size_t size_ = 0;
+#ifdef _WIN32
+  // handles of the file and of its mapping
+  void* file_ = nullptr;
+  void* mapping_ = nullptr;
+#endif
+  // the assets by their names (views of the mapped index)
+  std::unordered_map<std::string_view, AssetEntry> entries_;
+};
+
+#endif // !AssetPack_hpp
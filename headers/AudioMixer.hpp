@@ -1,10 +1,12 @@
 #ifndef AudioMixer_hpp
 #define AudioMixer_hpp
+#include "AssetLoader.hpp"
 #include "Enums.hpp"
 #include "SDL_mixer.h"
 #include "SDLexception.hpp"
 #include <functional>
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 // helper class for AudioMixer. It's sole task is to initialize SDL sound mixer
@@ -31,9 +33,11 @@ class AudioMixer
   public:
   // Constructor. Initializes support for replaying audio sound effects.
   // Takes vector of sound enum codes and coresponding strings to path of sounds
-  // to be replayed. Will throw SDLexception if initialization of sound mixer
-  // support or loading of the sound  effect will fail
-  AudioMixer(const std::unordered_map<Sound, std::string>& soundsAndPaths);
+  // to be replayed and the loader reading the sounds. Will throw SDLexception
+  // if initialization of sound mixer support or loading of the sound  effect
+  // will fail
+  AudioMixer(const std::unordered_map<Sound, std::string>& soundsAndPaths,
+      const AssetLoader& assets);
   // usage of RAII resource management helper classes  allows
   // for default destructor
   ~AudioMixer() = default;
@@ -45,11 +49,17 @@ class AudioMixer
   void PlaySound(Sound soundCode);
 
   private:
+  // pointer to a loaded sound with custom deleter
+  using ChunkPtr = std::unique_ptr<Mix_Chunk, std::function<void(Mix_Chunk*)>>;
+
+  // Loads the sound with the given path through the loader, converted to the
+  // format of the opened mixer. Can run on any thread. Throws SDLexception if
+  // loading the sound fails
+  static ChunkPtr LoadSound(const AssetLoader& assets, const std::string& path);
+
   MixOpener mix_opener_;
   // container used for combining enum sound codes with pointers to Mix_Chunks
-  std::unordered_map<Sound,
-      std::unique_ptr<Mix_Chunk, std::function<void(Mix_Chunk*)>>>
-      sound_effects_;
+  std::unordered_map<Sound, ChunkPtr> sound_effects_;
 };
 
 #endif // !AudioMixer_hpp
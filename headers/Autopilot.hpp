@@ -0,0 +1,33 @@
+#ifndef Autopilot_hpp
+#define Autopilot_hpp
+#include "Arena.hpp"
+
+// Automatic paddle steering policy used for playing the game without
+// a player, e.g. in batch simulations. The paddle follows the ball which
+// will reach the bottom of the screen first: it starts moving once the ball
+// gets out of the tolerated range and stops under the ball. The balls
+// waiting on the paddle are started immediately.
+class Autopilot
+{
+  public:
+  // Constructor. Takes the horizontal distance (pixels) between the paddle
+  // and the followed ball which is tolerated without moving the paddle.
+  // Throws std::invalid_argument if the tolerance is negative
+  explicit Autopilot(float tolerance = 10.0f);
+
+  // Steers the paddle of the arena; to be called before every update.
+  // Returns the time (seconds) the steering stays valid as long as the balls
+  // keep their velocities, i.e. until the paddle reaches the followed ball
+  float Steer(Arena& arena) const;
+
+  private:
+  // returns the time after which the horizontal offset of the followed ball
+  // from the paddle, changing with the given rate, leaves the tolerated
+  // range (the paddle stopped) or gets to zero (the paddle moving)
+  float TimeToChange(float offset, float offsetRate, bool paddleMoving) const;
+
+
+  // tolerated horizontal distance between the paddle and the followed ball
+  const float tolerance_;
+};
+#endif // !Autopilot_hpp
@@ -1,52 +1,61 @@
 #ifndef Ball_HPP
 #define Ball_HPP
-#include "Block.hpp"
+#include "BlockField.hpp"
+#include "Collision.hpp"
 #include "Enums.hpp"
 #include "MovableObject.hpp"
 #include "Paddle.hpp"
-#include "RandNum.hpp"
 #include "SideWall.hpp"
-#include "Texture.hpp"
 #include "Vector2d.hpp"
 #include <vector>
 
 // class forward declarations
 class Paddle;
-class Game;
+class Arena;
 class SideWall;
-class Block;
 
-// class representing the ball in the game
-class Ball : public virtual MovableObject
+// Class representing the ball in the game. The class is final, so the balls
+// stored by value in the BallPool are updated without virtual calls. It holds
+// no references, so the balls can be copied and moved within the pool
+class Ball final : public virtual MovableObject
 {
   public:
   /* Constructor. Takes:
       speed - ball sclar speed in pixels / second
-      texture - texture used for displaying the ball
+      radius - ball radius in pixels
       paddle - reference to paddle against ball collision will be checked
-      game - reference to the main game object
+      screenBottomY - y coordinate of the bottom of the screen
+      arena - reference to the game area the ball moves in
       sideWalls - reference to sideWalls for collision detection
       blocks - blocks to be shot at; for collision detection
   Throws std::invalid_argument if the arguments sent to the constructor where
   invalid */
-  Ball(float speed, const Texture& texture, Paddle& paddle, float screenBottomY,
-      Game& game, const std::vector<SideWall>& sideWalls,
-      std::vector<Block>& blocks);
+  Ball(float speed, float radius, Paddle& paddle, float screenBottomY,
+      Arena& arena, const std::vector<SideWall>& sideWalls,
+      const BlockField& blocks);
 
   // default virtual destructor
   ~Ball() override = default;
 
   // update ball state with given time difference from last update
   void Update(float deltaTime) override;
-  // render the ball
-  void Draw() const override;
+  // moves the ball along a straight line without any collision tests; may be
+  // used only for the time predicted by TimeToNextContact()
+  void Drift(float deltaTime) { position_ += velocity_ * deltaTime; }
+  // Predicts the time (seconds) the ball can move along a straight line
+  // without touching a wall, a block or the paddle. Outside the region the
+  // paddle moves in, that is the time until the ball reaches the region.
+  // Within the region the moves of the paddle can't be predicted, so it is
+  // the time the paddle needs to reach the ball at its top speed, whatever
+  // its steering. Returns 0 for the ball waiting on the paddle or touching it.
+  float TimeToNextContact() const;
   // sets current speed of the object if it is not lower than minimal speed
   void SetSpeed(float speed) override;
   // sets the speed increase/decrease applied when the ball hits the paddle
   void SetSpeedDelta(float speedChange) { speed_delta_ = speedChange; }
-  // updates ball direction and velocity vector;
-  // takes new  direction angle in degrees
-  void UpdateDirectionAndVelocity(float directionAngle);
+  // sets the direction of the ball movement keeping the current speed;
+  // takes any non-zero vector pointing in the new direction
+  void SetDirection(const gMath::Vector2d& direction);
   // resets ball min speed and speed values to the passed value and
   // sets position to the starting position on the paddle
   void Reset(float speed);
@@ -59,64 +68,64 @@ class Ball : public virtual MovableObject
 
   // returns ball radius
   float Radius() const { return radius_; }
+  // returns ball vector of velocity (pixels / second)
+  gMath::Vector2d Velocity() const { return velocity_; }
+  // checks if the ball has left the screen
+  bool HasLeftScreen() const;
   // checks if the ball is in the starting position
   bool IsMoving() const { return !in_starting_pos_; }
 
   private:
+  // describes the earliest obstacle touched by the ball within a single move
+  struct Contact
+  {
+    // kind of obstacle being hit
+    Obstacle obstacle = Obstacle::None;
+    // time of impact and the border being hit
+    gMath::SweepHit hit {};
+    // index of the block being hit (valid for Obstacle::Block only)
+    std::size_t block_index = 0;
+  };
+
   // checks for collision with the paddle. Returns true if colided, false if not
   bool HasHitPaddle() const;
-  // checks if the ball has hit the paddle. If so, updates the game state
-  // accoringly:
-  // - changes ball direction after bounce - including applying spin
-  // - increases or decreases speed if the user gave a command via controller
-  void HandlePaddleCollisions();
-  // checks if the ball has hit any of the walls. If so, updates the game state
-  // accordingly
-  void HandleWallCollisions();
-  // checks if the ball has hit any of the blocks. If so, updates the game state
-  // accordingly
-  void HandleBlockCollisions();
-  // checks if the ball has left the screen
-  bool HasLeftScreen() const;
-  // check if the ball has collided with the specific wall
-  bool HasHitWall(const SideWall& wall) const;
-  // updates ball's direction angle and velocity vector depending on wall hit
-  void BounceWall(const SideWall& wall);
-  // calculates the ball new direction after hitting left wall
-  float NewDirectionLeftWallBounced() const;
-  // calculates the ball new direction after hitting right wall
-  float NewDirectionRightWallBounced() const;
-  // calculates the ball new direction after hitting top wall
-  float NewDirectionTopWallBounced() const;
+  // finds the earliest contact of the ball with any obstacle when moving
+  // by the given displacement
+  Contact FindEarliestContact(const gMath::Vector2d& displacement) const;
+  // updates the contact if any of the walls is hit earlier
+  void FindWallContact(
+      const gMath::Vector2d& displacement, Contact& contact) const;
+  // updates the contact if the paddle is hit earlier
+  void FindPaddleContact(
+      const gMath::Vector2d& displacement, Contact& contact) const;
+  // updates the contact if any of the blocks is hit earlier
+  void FindBlockContact(
+      const gMath::Vector2d& displacement, Contact& contact) const;
+  // updates the contact if the region the paddle moves in is reached earlier
+  void FindPaddleRegionContact(
+      const gMath::Vector2d& displacement, Contact& contact) const;
+  // updates the contact if the hit is earlier than the one already found;
+  // returns true if the contact was updated
+  bool KeepEarlier(const gMath::SweepHit& hit, Obstacle obstacle,
+      Contact& contact) const;
+  // reacts to the contact with an obstacle: bounces the ball and updates the
+  // game state accordingly
+  void ResolveContact(const Contact& contact);
+  // reflects the velocity off the surface described by its unit normal;
+  // doesn't affect the ball moving away from the surface
+  void Bounce(const gMath::Vector2d& normal);
   // change the ball direction after hitting paddle
   void BouncePaddle();
-  // checks if the ball hit a specific block
-  bool HasHitBlock(const Block& block) const;
-  // change the ball direction after hitting particualr block
-  void BounceBlock(const Block& block);
-  // returns new direction after block bounce when going up and right
-  float BounceBlockGoingUpRight(float leftX) const;
-  // returns new direction after block bounce when going up and left
-  float BounceBlockGoingUpLeft(float rightX) const;
-  // returns new direction after block bounce when going down and left
-  float BounceBlockGoingDownLeft(float rightX) const;
-  // returns new direction after block bounce when going down and right
-  float BounceBlockGoingDownRight(float leftX) const;
-  // keeps the ball direction angle in range [0,360)
-  void ControlDirection();
   // calculates the spin to be applied
   float CalcSpin(float bounceAngle) const;
   // increases/deacreases the ball speed by speed delta
   void ApplySpeedDelta();
 
-  // ball direction in degrees (0.0 - 360.0)
-  float direction_;
-  // ball vector of velocity
+  // ball vector of velocity; the length of the vector equals the ball speed
+  // once the ball has started
   gMath::Vector2d velocity_;
-  // texture used for displaying the ball
-  const Texture& texture_;
   // ball radius
-  const float radius_;
+  float radius_;
   // indicates if the ball is in starting position on the paddle
   bool in_starting_pos_ = true;
   // current value of spin to be applied
@@ -125,18 +134,23 @@ class Ball : public virtual MovableObject
   float min_speed_;
   // speed change (pixels/second) aplied every time the ball hits the paddle
   float speed_delta_ = 0.0;
-  // reference to paddle for collision detection
-  Paddle& paddle_;
+  // maximum number of contacts resolved within a single update; the rest of
+  // the update time is dropped if the ball gets stuck between obstacles
+  static constexpr unsigned max_contacts_per_update = 8;
+  // sine and cosine of the smallest angle (5 degrees) between the ball path
+  // and the paddle after bouncing off the paddle
+  static constexpr float min_paddle_angle_sin = 0.0871557f;
+  static constexpr float min_paddle_angle_cos = 0.9961947f;
+  // NOT OWNED pointer to paddle for collision detection
+  Paddle* paddle_;
   // y coordinate of the bottom of the screen
-  const float screen_bottom_y_;
-  // reference to the main game object
-  Game& game_;
-  // random number generator used for simulating angle changes
-  gMath::RandNum randomizer_;
-  // sideWalls for collision detection
-  const std::vector<SideWall>& side_walls_;
-  // blocks for collision detection
-  std::vector<Block>& _blocks;
+  float screen_bottom_y_;
+  // NOT OWNED pointer to the game area the ball moves in
+  Arena* arena_;
+  // NOT OWNED pointer to sideWalls for collision detection
+  const std::vector<SideWall>* side_walls_;
+  // NOT OWNED pointer to blocks for collision detection
+  const BlockField* blocks_;
 };
 
 #endif // !Ball_HPP
\ No newline at end of file
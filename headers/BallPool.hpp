@@ -0,0 +1,65 @@
+#ifndef BallPool_hpp
+#define BallPool_hpp
+#include "Ball.hpp"
+#include "CollisionScheduler.hpp"
+#include <cstddef>
+#include <vector>
+
+// Fixed-capacity container of all the balls in play. The balls are stored by
+// value in a single contiguous array, whose storage is allocated once at
+// construction, so adding a ball never allocates memory and never invalidates
+// references to the balls already in play. All the balls are updated in a
+// single pass and the balls which have left the screen are removed by swapping
+// them with the last one. The next contact of every ball is predicted and kept
+// in a CollisionScheduler, so until then the ball is moved without any
+// collision tests.
+class BallPool
+{
+  public:
+  // Constructor. Takes the maximum number of balls in play and the ball
+  // serving as a prototype for the ball put on the paddle after Reset().
+  // The pool starts with a single ball on the paddle.
+  // Throws std::invalid_argument if the capacity is 0
+  BallPool(std::size_t capacity, const Ball& prototype);
+
+  // updates all the balls by the given time difference and removes the ones
+  // which have left the screen; returns the number of balls removed
+  std::size_t Update(float deltaTime);
+  // Returns the time (seconds) until the earliest predicted contact of any
+  // ball. Updates not longer than that move all the balls along straight
+  // lines, so they may be as long as the time in the simulations where
+  // nothing else changes in the meantime.
+  float TimeToNextEvent();
+  // Adds a ball split off the given one: starting from the same position,
+  // but heading in the mirrored direction. Returns false if the pool is full
+  bool Spawn(const Ball& source);
+  // leaves a single ball with the given speed in the starting position on
+  // the paddle
+  void Reset(float speed);
+
+  // returns the number of balls in play
+  std::size_t Size() const { return balls_.size(); }
+  // returns the maximum number of balls in play
+  std::size_t Capacity() const { return capacity_; }
+  // checks if there are no balls in play
+  bool Empty() const { return balls_.empty(); }
+
+  // iterators over the balls in play
+  std::vector<Ball>::iterator begin() { return balls_.begin(); }
+  std::vector<Ball>::iterator end() { return balls_.end(); }
+  std::vector<Ball>::const_iterator begin() const { return balls_.begin(); }
+  std::vector<Ball>::const_iterator end() const { return balls_.end(); }
+
+  private:
+  // maximum number of balls in play
+  const std::size_t capacity_;
+  // copied into the pool whenever the ball is put back on the paddle
+  const Ball prototype_;
+  // the balls in play
+  std::vector<Ball> balls_;
+  // predicted contacts of the balls, by their index in balls_
+  CollisionScheduler scheduler_;
+  // simulation time (seconds) the contacts are scheduled in
+  double clock_ = 0.0;
+};
+#endif // !BallPool_hpp
@@ -0,0 +1,92 @@
+#ifndef BatchRunner_hpp
+#define BatchRunner_hpp
+#include "Arena.hpp"
+#include "AssetPack.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// settings of a batch of games simulated without display
+struct BatchSettings
+{
+  // number of games to play
+  unsigned games = 100;
+  // number of worker threads; 0 means one thread per hardware core
+  unsigned threads = 0;
+  // seed of the first game; the following games get consecutive seeds
+  std::uint32_t seed = 1;
+  // level played in every game
+  unsigned level = 1;
+  // simulated time (seconds) after which an unfinished game is abandoned
+  float time_limit = 600.0f;
+  // duration of a single simulation step in seconds
+  float time_step = 1.0f / 240.0f;
+  // If true, the simulation jumps straight from event to event (contacts of
+  // the balls and changes of the paddle steering) instead of making all the
+  // steps in between. It is much faster, but only an approximation: the
+  // longer updates round differently and the autopilot steers at other
+  // moments, so a seed gives another game than when stepping
+  bool event_jumping = false;
+  // path to the directory with level files
+  std::string levels_path;
+  // NOT OWNED asset pack the level files are read from; the files are read
+  // from the levels path if it's nullptr
+  const AssetPack* assets = nullptr;
+  // number of levels implemented
+  unsigned levels_implemented = 10;
+};
+
+// result of a single game of the batch
+struct GameResult
+{
+  // seed the game was played with; allows to reproduce the game
+  std::uint32_t seed = 0;
+  // indicates if all the blocks of the level have been destroyed
+  bool cleared = false;
+  // points achieved
+  unsigned score = 0;
+  // simulated time (seconds) of the game; the time to clear the level if
+  // cleared
+  float time = 0.0f;
+  // number of lives (balls) lost
+  unsigned balls_lost = 0;
+  // number of bounces off walls, the paddle and blocks
+  unsigned bounces = 0;
+};
+
+// Plays a batch of games of a single level concurrently on a pool of worker
+// threads, with the paddle steered by the Autopilot. Every game owns all its
+// state (the Arena with its stream of random numbers seeded with the game
+// seed), so the workers share nothing but the counter of the games taken and
+// the results are reproducible regardless of the number of threads.
+class BatchRunner
+{
+  public:
+  // Constructor. Takes the settings of the batch.
+  // Throws std::invalid_argument if the settings are invalid
+  explicit BatchRunner(const BatchSettings& settings);
+
+  // plays all the games of the batch and returns their results in the order
+  // of the seeds; exceptions thrown by the games are passed on
+  std::vector<GameResult> Run() const;
+
+  private:
+  // counts the events of a single game
+  struct EventCounter : public ArenaListener
+  {
+    // updates the counters
+    void OnEvent(const EventRecord& event) override;
+
+    // number of lives (balls) lost
+    unsigned balls_lost = 0;
+    // number of bounces off walls, the paddle and blocks
+    unsigned bounces = 0;
+  };
+
+  // plays a single game with the given seed and returns its result
+  GameResult PlayGame(std::uint32_t seed) const;
+
+  // settings of the batch
+  const BatchSettings settings_;
+};
+#endif // !BatchRunner_hpp
@@ -0,0 +1,102 @@
+#ifndef BlockField_hpp
+#define BlockField_hpp
+#include "BlockGrid.hpp"
+#include "Enums.hpp"
+#include "Vector2d.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Container of all the blocks in the level, stored as a structure of arrays:
+// block centres, half extents, sprites and point values are kept in separate
+// contiguous arrays and the destroyed state in a packed bitset. Collision
+// detection touches only the arrays it needs, and the number of blocks not yet
+// destroyed is tracked, so checking for the level completion costs nothing.
+// Blocks are placed on a regular lattice and indexed by a BlockGrid.
+class BlockField
+{
+  public:
+  // Constructor. Takes the position of the top-left corner of the lattice,
+  // the size of a single block and the number of columns and rows.
+  // Throws std::invalid_argument if the lattice dimensions are not positive
+  BlockField(float originX, float originY, float blockWidth, float blockHeight,
+      std::size_t columns, std::size_t rows);
+
+  // removes all the blocks
+  void Clear();
+  // Adds a block into the lattice cell described by column and row. Takes the
+  // sprite used for displaying the block and the number of points the player
+  // will be awarded after the block is destroyed. Returns index of the block.
+  // Throws std::invalid_argument if the point value is not positive and
+  // std::out_of_range if the cell lies outside the lattice
+  std::size_t Add(std::size_t column, std::size_t row, Sprite sprite,
+      unsigned pointValue);
+  // marks the block as destroyed and removes it from the spatial index
+  void Destroy(std::size_t index);
+
+  // returns the number of blocks (destroyed ones included)
+  std::size_t Size() const { return x_.size(); }
+  // returns the number of blocks which have not been destroyed
+  std::size_t LiveCount() const { return live_count_; }
+  // Returns the number of times the blocks have been removed by Clear(), so
+  // a change of the value means the blocks were replaced (a new level)
+  unsigned Generation() const { return generation_; }
+  // checks if the block has been destroyed
+  bool IsDestroyed(std::size_t index) const
+  {
+    return (destroyed_[index / bits_per_word] >> (index % bits_per_word)) & 1u;
+  }
+  // returns position of the block centre
+  gMath::Vector2d Position(std::size_t index) const
+  {
+    return gMath::Vector2d(x_[index], y_[index]);
+  }
+  // returns half of the width of the block
+  float HalfWidth(std::size_t index) const { return half_width_[index]; }
+  // returns half of the height of the block
+  float HalfHeight(std::size_t index) const { return half_height_[index]; }
+  // returns the sprite used for displaying the block
+  Sprite SpriteOf(std::size_t index) const { return sprites_[index]; }
+  // returns points value assigned to the block
+  unsigned Points(std::size_t index) const { return points_[index]; }
+
+  // Calls the function for the index of every block not yet destroyed which
+  // lies in the lattice cells overlapping the rectangle described by its
+  // top-left (min) and bottom-right (max) corners
+  template <typename Function>
+  void ForEachInArea(
+      float minX, float minY, float maxX, float maxY, Function&& function) const
+  {
+    grid_.ForEachInArea(minX, minY, maxX, maxY, function);
+  }
+
+  private:
+  // number of destroyed flags packed into a single word of the bitset
+  static constexpr std::size_t bits_per_word = 64;
+
+  // position of the top-left corner of the lattice
+  const float origin_x_;
+  const float origin_y_;
+  // size of a single block (lattice cell)
+  const float block_width_;
+  const float block_height_;
+  // coordinates of the block centres
+  std::vector<float> x_;
+  std::vector<float> y_;
+  // half extents of the blocks; spare calculations while collision detection
+  std::vector<float> half_width_;
+  std::vector<float> half_height_;
+  // sprites used for displaying the blocks
+  std::vector<Sprite> sprites_;
+  // point values assigned to the blocks
+  std::vector<unsigned> points_;
+  // destroyed flags of the blocks packed into 64-bit words
+  std::vector<std::uint64_t> destroyed_;
+  // number of blocks which have not been destroyed
+  std::size_t live_count_ = 0;
+  // number of times the blocks have been removed by Clear()
+  unsigned generation_ = 0;
+  // spatial index of the blocks not yet destroyed
+  BlockGrid grid_;
+};
+#endif // !BlockField_hpp
@@ -0,0 +1,95 @@
+#ifndef BlockGrid_hpp
+#define BlockGrid_hpp
+#include "Vector2d.hpp"
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Uniform grid spatial index of the blocks in the level. The blocks sit on
+// a regular lattice, so every cell of the grid holds at most one block,
+// represented by its index in the container of blocks. Only blocks which have
+// not been destroyed are kept in the grid.
+class BlockGrid
+{
+  public:
+  // Constructor. Takes the position of the top-left corner of the grid,
+  // the size of a single cell and the number of columns and rows.
+  // Throws std::invalid_argument if the grid dimensions are not positive
+  BlockGrid(float originX, float originY, float cellWidth, float cellHeight,
+      std::size_t columns, std::size_t rows);
+
+  // removes all the blocks from the grid
+  void Clear();
+  // Puts the block index into the cell described by column and row.
+  // Throws std::out_of_range if the cell lies outside the grid
+  void Insert(std::size_t column, std::size_t row, std::size_t blockIndex);
+  // removes the block from the cell containing the given point (for example
+  // the block centre); does nothing if the point lies outside the grid
+  void Remove(const gMath::Vector2d& point);
+
+  // Calls the function for the index of every block in the cells overlapping
+  // the rectangle described by its top-left (min) and bottom-right (max)
+  // corners. Each block is visited once
+  template <typename Function>
+  void ForEachInArea(
+      float minX, float minY, float maxX, float maxY, Function&& function) const
+  {
+    // nothing to do if the area lies entirely outside the grid
+    if (maxX < origin_x_ || maxY < origin_y_ || minX >= origin_x_ + width_
+        || minY >= origin_y_ + height_) {
+      return;
+    }
+    // range of cells overlapped by the area
+    const std::size_t first_column
+        = CellOf(minX, origin_x_, cell_width_, columns_ - 1);
+    const std::size_t last_column
+        = CellOf(maxX, origin_x_, cell_width_, columns_ - 1);
+    const std::size_t first_row
+        = CellOf(minY, origin_y_, cell_height_, rows_ - 1);
+    const std::size_t last_row
+        = CellOf(maxY, origin_y_, cell_height_, rows_ - 1);
+
+    for (std::size_t row = first_row; row <= last_row; row++) {
+      for (std::size_t column = first_column; column <= last_column;
+           column++) {
+        const std::size_t block_index = cells_[row * columns_ + column];
+        if (block_index != empty_cell) {
+          function(block_index);
+        }
+      }
+    }
+  }
+
+  // value marking a cell without a block
+  static constexpr std::size_t empty_cell = static_cast<std::size_t>(-1);
+
+  private:
+  // Returns the cell number (column or row) containing the coordinate,
+  // clamped to the range [0, maxCell]. Helper for ForEachInArea()
+  static std::size_t CellOf(
+      float coordinate, float origin, float cellSize, std::size_t maxCell)
+  {
+    const float cell = std::floor((coordinate - origin) / cellSize);
+    if (cell <= 0.0f) {
+      return 0;
+    }
+    const std::size_t index = static_cast<std::size_t>(cell);
+    return index < maxCell ? index : maxCell;
+  }
+
+  // position of the top-left corner of the grid
+  const float origin_x_;
+  const float origin_y_;
+  // size of a single cell
+  const float cell_width_;
+  const float cell_height_;
+  // number of cells in a row and in a column
+  const std::size_t columns_;
+  const std::size_t rows_;
+  // size of the whole grid; spares calculations while querying
+  const float width_;
+  const float height_;
+  // block indexes stored row by row; empty_cell marks cells without a block
+  std::vector<std::size_t> cells_;
+};
+#endif // !BlockGrid_hpp
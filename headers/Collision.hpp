@@ -0,0 +1,45 @@
+#ifndef Collision_hpp
+#define Collision_hpp
+#include "Enums.hpp"
+#include "Vector2d.hpp"
+
+// namespace for grouping objects and functions required for the game
+// calculations
+namespace gMath {
+
+// axis-aligned rectangle described by its top-left corner and size
+struct Rect
+{
+  float x;
+  float y;
+  float w;
+  float h;
+};
+
+// result of a swept collision test
+struct SweepHit
+{
+  // fraction of the tested displacement (0.0 - 1.0) after which the contact
+  // occurs
+  float time;
+  // border of the rectangle being hit
+  RectBorder border;
+  // unit normal of the hit surface pointing towards the moving circle
+  Vector2d normal;
+};
+
+// Sweeps a circle (start position and radius) along the displacement vector
+// against an axis-aligned rectangle (centre and half extents) and finds the
+// earliest time of impact. Rounded corners of the swept shape are taken into
+// account, so a ball passing close to a corner is not reported as a hit.
+// If the circle already overlaps the rectangle, a hit at time 0.0 is reported
+// only when the displacement leads deeper into the rectangle (so an object
+// which has just bounced can always escape).
+// Returns true and fills the hit if the contact occurs within the
+// displacement, false otherwise
+bool SweepCircleRect(const Vector2d& start, const Vector2d& displacement,
+    float radius, const Vector2d& rectCentre, float halfWidth,
+    float halfHeight, SweepHit& hit);
+
+} // end of gMath namespace
+#endif // !Collision_hpp
@@ -0,0 +1,77 @@
+#ifndef CollisionScheduler_hpp
+#define CollisionScheduler_hpp
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Priority queue of the predicted contacts of the balls. Between two contacts
+// a ball moves along a straight line, so once the time of its next contact is
+// known, the ball can be moved without any collision tests until then.
+// Every ball (identified by its slot in the BallPool) has at most one valid
+// contact scheduled. Rescheduling or cancelling doesn't search the queue: the
+// old entry is invalidated by bumping the version of the slot and discarded
+// lazily when it reaches the top of the queue.
+class CollisionScheduler
+{
+  public:
+  // Constructor. Takes the number of slots (balls) to be scheduled.
+  // Throws std::invalid_argument if the number of slots is 0
+  explicit CollisionScheduler(std::size_t slots);
+
+  // schedules the next contact of the ball in the slot at the given time
+  // (seconds of the simulation clock), replacing the previous one
+  void Schedule(std::size_t slot, double time);
+  // cancels the contact scheduled for the ball in the slot
+  void Cancel(std::size_t slot);
+  // cancels the contacts scheduled for all the balls
+  void CancelAll();
+
+  // checks if the ball in the slot can't touch anything before the given
+  // time, that is its contact is scheduled later
+  bool IsFreeUntil(std::size_t slot, double time) const
+  {
+    return times_[slot] > time;
+  }
+  // returns the time of the earliest contact scheduled, or infinity if
+  // nothing is scheduled; discards the invalidated entries on the way
+  double NextEventTime();
+
+  private:
+  // a contact stored in the queue
+  struct Event
+  {
+    // time of the contact
+    double time;
+    // slot of the ball
+    std::size_t slot;
+    // version of the slot when the event was scheduled; the event is valid
+    // only as long as it matches the current version
+    std::uint32_t version;
+  };
+
+  // ordering making the queue a min-heap by the time of the contact
+  struct Later
+  {
+    bool operator()(const Event& lhs, const Event& rhs) const
+    {
+      return lhs.time > rhs.time;
+    }
+  };
+
+  // checks if the event hasn't been invalidated
+  bool IsValid(const Event& event) const
+  {
+    return versions_[event.slot] == event.version;
+  }
+  // removes all the invalidated events; called when they fill most of the
+  // queue, as a game which never asks for the next event never pops them
+  void Compact();
+
+  // the heap of events (including the invalidated ones)
+  std::vector<Event> queue_;
+  // current version of every slot
+  std::vector<std::uint32_t> versions_;
+  // time of the valid contact of every slot; minus infinity if none
+  std::vector<double> times_;
+};
+#endif // !CollisionScheduler_hpp
@@ -1,12 +1,16 @@
 #ifndef CONTROLLER_HPP
 #define CONTROLLER_HPP
-#include "Ball.hpp"
+#include "Enums.hpp"
 #include "Game.hpp"
-#include "Paddle.hpp"
 #include "SDL.h"
 #include <exception>
 
-// class for controling input and steering from the keyboard
+// class forward declarations
+class Game;
+
+// Class for controling input and steering from the keyboard. The steering
+// keys are translated into player commands passed to the game, which applies
+// them to the game area on the simulation thread
 class Controller
 {
   public:
@@ -14,14 +18,13 @@ class Controller
   Controller(Game& game);
 
   // Handles all the input events
-  // Takes the paddle and ball to synchronise game control
-  void HandleInput(bool& running, Paddle& paddle, Ball& ball) const;
+  void HandleInput() const;
 
   private:
   // handles input events specific to the game paused state
   void HandlePausedEvents() const;
   // handles input events specific to the game routine running
-  void HandleRoutineEvents(Paddle& paddle, Ball& ball) const;
+  void HandleRoutineEvents() const;
   // handles input events specific to the game over or won
   void HandleGameOverEvents() const;
 
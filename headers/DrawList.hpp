@@ -0,0 +1,62 @@
+#ifndef DrawList_HPP
+#define DrawList_HPP
+#include "Enums.hpp"
+#include "SDL.h"
+#include <cstdint>
+#include <vector>
+
+// a request for copying a rectangle of a texture to the screen
+struct DrawCommand
+{
+  // the texture to copy from
+  SDL_Texture* texture;
+  // the copied rectangle of the texture
+  SDL_Rect source;
+  // the rectangle covered on the screen; sub-pixel positions are kept
+  SDL_FRect destination;
+  // colour the texture is multiplied by
+  SDL_Color tint;
+  // the layer of the screen the rectangle belongs to
+  DrawLayer layer;
+  // position in the order of adding; keeps the order of the commands with
+  // the same layer and texture
+  std::uint32_t sequence;
+};
+
+// The commands for drawing a frame. The displayed objects only add commands
+// to the list; the list is then sorted by layer and texture and executed in
+// a single loop, where all the consecutive commands with the same texture are
+// drawn as one batch of quads with a single geometry call. Within a layer
+// the commands with different textures are not expected to overlap, as their
+// relative order is not kept. The buffers are kept between the frames, so
+// after the first frames drawing allocates no memory.
+class DrawList
+{
+  public:
+  // adds a command for copying the source rectangle of the texture to the
+  // destination rectangle of the screen within the given layer
+  void Add(DrawLayer layer, SDL_Texture* texture, const SDL_Rect& source,
+      const SDL_FRect& destination,
+      SDL_Color tint = SDL_Color { 255, 255, 255, 255 });
+  // draws all the commands in the order of layers and empties the list
+  void Submit(SDL_Renderer* sdlRenderer);
+  // removes all the commands
+  void Clear() { commands_.clear(); }
+  // returns the number of commands waiting to be drawn
+  std::size_t Size() const { return commands_.size(); }
+
+  private:
+  // adds the quad of the command to the vertex and index buffers; takes the
+  // size of the texture of the command
+  void AddQuad(const DrawCommand& command, float textureWidth,
+      float textureHeight);
+
+  // the commands of the frame
+  std::vector<DrawCommand> commands_;
+  // 4 vertices (corners) of every quad of the current batch
+  std::vector<SDL_Vertex> vertices_;
+  // 6 indices (2 triangles) of every quad of the current batch
+  std::vector<int> indices_;
+};
+
+#endif // !DrawList_HPP
@@ -10,6 +10,15 @@ enum class RectBorder : short
   Left
 };
 
+// enum for distinguishing the kind of obstacle hit by the ball
+enum class Obstacle : short
+{
+  None,
+  Wall,
+  Paddle,
+  Block
+};
+
 // enum for describing the spin of the ball
 enum class Spin : short
 {
@@ -71,6 +80,92 @@ enum class GameState : char
   Won
 };
 
+// enum representing the commands of the player steering the game
+enum class PlayerCommand : short
+{
+  // no steering key pressed: stop the paddle, no spin or speed change
+  None,
+  MoveUp,
+  MoveDown,
+  MoveLeft,
+  MoveRight,
+  SpinLeft,
+  SpinRight,
+  SpeedUp,
+  SlowDown,
+  // start the ball waiting on the paddle
+  StartBall
+};
+
+// enum representing the info screens interrupting the game for a while
+enum class Interlude : char
+{
+  None,
+  // a ball was lost, but the player has balls left
+  BallLost,
+  // the level was completed and the next one loaded
+  LevelCompleted
+};
+
+// enum representing where the frames are rendered
+enum class RenderMode : char
+{
+  // into a window presented on the screen (with vsync)
+  Window,
+  // into a surface in memory by the software renderer; nothing is presented,
+  // so no display (nor graphics device) is needed
+  Offscreen
+};
+
+// enum representing how an asset is stored in the asset pack
+enum class AssetKind : unsigned char
+{
+  // the contents of the asset file as they are
+  File,
+  // an image decoded in advance: rows of RGBA32 pixels with no padding
+  RgbaImage
+};
+
+// enum representing the formats the displayed frames can be recorded in
+enum class CaptureFormat : char
+{
+  // a single uncompressed YUV4MPEG2 (4:4:4) video stream
+  Y4m,
+  // a sequence of PNG images, one per frame
+  PngSequence
+};
+
+// enum representing the layers of the displayed screen, from the bottom one
+enum class DrawLayer : unsigned char
+{
+  // counters displayed behind the game objects
+  Hud,
+  // walls and blocks
+  Arena,
+  // the paddle and the balls
+  Movable,
+  // texts of the info screens
+  Text
+};
+
+// enum representing events happening in the game area, which may be
+// interesting outside of the game simulation (sound effects, screens etc.)
+enum class GameEvent : short
+{
+  // the ball has been started from the paddle
+  BallStarted,
+  // the ball has bounced off a wall
+  WallBounce,
+  // the ball has bounced off the paddle
+  PaddleHit,
+  // a block has been destroyed by the ball
+  BlockDestroyed,
+  // the ball has left the screen
+  BallLost,
+  // the last block of the level has been destroyed
+  LevelCleared
+};
+
 // enum representing sound effects usued in the game
 enum class Sound : short
 {
@@ -0,0 +1,65 @@
+#ifndef EventQueue_hpp
+#define EventQueue_hpp
+#include "Enums.hpp"
+#include <array>
+#include <cstddef>
+
+// a game event together with the number of its occurrences coalesced into
+// the record and the points awarded for them
+struct EventRecord
+{
+  // kind of the event
+  GameEvent type;
+  // number of occurrences of the event
+  unsigned count;
+  // points awarded for the occurrences (destroyed blocks)
+  unsigned points;
+};
+
+// Queue of the game events which happened since it was last cleared. The
+// simulation only appends to it, and the consumers (scoring, sounds, info
+// screens, statistics) go through the recorded events once per frame, so the
+// physics calculations never wait for them. Duplicates of an event are
+// coalesced into a single record counting the occurrences, so the queue has
+// a record per kind of event at most, needs no allocation and a burst of
+// bounces within a frame can be handled (e.g. sounded) once.
+class EventQueue
+{
+  public:
+  // Constructor. Creates an empty queue
+  EventQueue() { Clear(); }
+
+  // records the event awarding the given points
+  void Push(GameEvent type, unsigned points = 0);
+  // removes all the records
+  void Clear();
+  // checks if the event has been recorded
+  bool Contains(GameEvent type) const { return index_[Kind(type)] != none; }
+  // checks if there are no records
+  bool Empty() const { return size_ == 0; }
+
+  // iterators over the records in the order of the first occurrences
+  const EventRecord* begin() const { return records_.data(); }
+  const EventRecord* end() const { return records_.data() + size_; }
+
+  private:
+  // number of kinds of events
+  static constexpr std::size_t kinds
+      = static_cast<std::size_t>(GameEvent::LevelCleared) + 1;
+  // index marking a kind of event without a record
+  static constexpr std::size_t none = kinds;
+
+  // returns the kind of the event as an index
+  static std::size_t Kind(GameEvent type)
+  {
+    return static_cast<std::size_t>(type);
+  }
+
+  // the records; only the first size_ are in use
+  std::array<EventRecord, kinds> records_ {};
+  // number of records in use
+  std::size_t size_ = 0;
+  // index of the record of every kind of event (none if not recorded)
+  std::array<std::size_t, kinds> index_;
+};
+#endif // !EventQueue_hpp
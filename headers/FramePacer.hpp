@@ -0,0 +1,72 @@
+#ifndef FramePacer_hpp
+#define FramePacer_hpp
+#include <chrono>
+
+// statistics of the frame intervals measured by the FramePacer
+struct FrameStats
+{
+  // number of frames measured
+  unsigned frames = 0;
+  // average frame interval in milliseconds
+  double mean_ms = 0.0;
+  // standard deviation of the frame interval in milliseconds
+  double jitter_ms = 0.0;
+  // shortest and longest frame interval in milliseconds
+  double min_ms = 0.0;
+  double max_ms = 0.0;
+};
+
+// Keeps the main loop at the target frame rate. Frame start times follow
+// a fixed schedule measured with the monotonic high resolution clock (with
+// nanosecond deltas), so the frame budget is not rounded to whole
+// milliseconds and the error doesn't accumulate. Waiting for the next frame
+// sleeps coarsely first and then yields the processor in a loop for the last
+// stretch, as the sleep functions of the operating systems routinely oversleep
+// by a millisecond or two. The intervals between frames are measured for
+// reporting the frame time jitter.
+class FramePacer
+{
+  public:
+  // Constructor. Takes the target frame rate (frames per second) and the time
+  // before the frame start at which sleeping is replaced by spinning.
+  // Throws std::invalid_argument if the frame rate is not positive or the spin
+  // margin is negative
+  explicit FramePacer(double framesPerSecond,
+      std::chrono::microseconds spinMargin = std::chrono::microseconds(2000));
+
+  // waits until the start of the next frame and measures the interval since
+  // the start of the previous one
+  void WaitForNextFrame();
+  // restarts the schedule from now, e.g. after the main loop was halted for
+  // displaying an info screen; the halted interval is not measured
+  void Restart();
+
+  // returns the number of frame intervals measured since the statistics were
+  // taken last time
+  unsigned FramesMeasured() const { return frames_; }
+  // returns the statistics of the frame intervals measured since they were
+  // taken last time and starts measuring anew
+  FrameStats TakeStats();
+
+  private:
+  using Clock = std::chrono::steady_clock;
+
+  // duration of a single frame
+  const Clock::duration frame_duration_;
+  // time before the frame start at which sleeping is replaced by spinning
+  const Clock::duration spin_margin_;
+  // scheduled start of the next frame
+  Clock::time_point next_frame_;
+  // actual start of the previous frame
+  Clock::time_point previous_frame_;
+
+  // accumulated statistics of the frame intervals (in milliseconds); the
+  // mean and the sum of squared deviations are updated with each frame
+  // (Welford's method), which is numerically stable
+  unsigned frames_ = 0;
+  double mean_ = 0.0;
+  double squared_deviations_ = 0.0;
+  double min_ = 0.0;
+  double max_ = 0.0;
+};
+#endif // !FramePacer_hpp
@@ -0,0 +1,98 @@
+#ifndef FrameRecorder_hpp
+#define FrameRecorder_hpp
+#include "Enums.hpp"
+#include "SDL.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Records the displayed frames to files without stalling the game loop. Each
+// frame is read back from the renderer into one of a pool of buffers
+// allocated once, and a background writer thread encodes the filled buffers
+// (a Y4M video stream or a sequence of PNG images) and returns them to the
+// pool. The game loop never waits for the disk: when all the buffers are
+// still waiting for the writer, the frame is dropped and counted instead.
+class FrameRecorder
+{
+  public:
+  // Constructor. Takes the path of the recording (the video file, or the
+  // prefix of the names of the images), its format, the size of the frames,
+  // the frame rate written into the video header and the number of frame
+  // buffers. Throws std::invalid_argument if the size or the number of
+  // buffers is 0 and std::runtime_error if the video file can't be created
+  FrameRecorder(const std::string& path, CaptureFormat format,
+      std::size_t width, std::size_t height, std::size_t frameRate,
+      std::size_t bufferCount = 8);
+  // Destructor. Writes the frames still waiting and stops the writer thread
+  ~FrameRecorder();
+
+  // the writer thread uses the object, so copy operations are disabled
+  FrameRecorder(const FrameRecorder&) = delete;
+  FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+  // Reads the frame rendered so far back from the renderer (to be called
+  // before presenting it) and queues it for writing, or drops it if no buffer
+  // is free. Never waits for the writer. Rethrows the exception which stopped
+  // the writer thread, if any, and throws SDLexception if reading the pixels
+  // fails
+  void Capture(SDL_Renderer* sdlRenderer);
+  // writes all the queued frames and stops the writer thread; capturing
+  // further frames drops them
+  void Finish();
+
+  // returns the number of frames written to files
+  std::size_t FramesWritten() const { return frames_written_; }
+  // returns the number of frames dropped, as no buffer was free
+  std::size_t FramesDropped() const { return frames_dropped_; }
+
+  private:
+  // WRITER THREAD: writes the queued frames until the recording finishes
+  void RunWriter();
+  // WRITER THREAD: appends the frame to the Y4M stream
+  void WriteY4mFrame(const std::vector<std::uint8_t>& pixels);
+  // WRITER THREAD: saves the frame as the next PNG image of the sequence
+  void WritePngFrame(const std::vector<std::uint8_t>& pixels);
+
+  // prefix of the paths of the images or the path of the video file
+  const std::string path_;
+  // format of the recording
+  const CaptureFormat format_;
+  // size of the frames
+  const std::size_t width_;
+  const std::size_t height_;
+  // the video stream (Y4M format only)
+  std::ofstream video_;
+  // RGBA32 pixels of the frames; allocated once
+  std::vector<std::vector<std::uint8_t>> buffers_;
+  // indices of the buffers free for capturing; guarded by mutex_
+  std::vector<std::size_t> free_buffers_;
+  // indices of the captured buffers waiting for the writer, in the order of
+  // capturing; guarded by mutex_
+  std::deque<std::size_t> filled_buffers_;
+  // set when no more frames are captured; guarded by mutex_
+  bool finishing_ = false;
+  std::mutex mutex_;
+  // wakes up the writer thread when a frame is queued or the recording
+  // finishes
+  std::condition_variable frame_queued_;
+  // WRITER THREAD: the Y, Cb and Cr planes of a video frame
+  std::vector<std::uint8_t> planes_;
+  // counters of the frames
+  std::atomic<std::size_t> frames_written_ { 0 };
+  std::atomic<std::size_t> frames_dropped_ { 0 };
+  // the exception which stopped the writer thread
+  std::exception_ptr writer_error_;
+  std::atomic<bool> writer_failed_ { false };
+  // the thread writing the frames; started last, when all the members it uses
+  // are ready
+  std::thread writer_;
+};
+#endif // !FrameRecorder_hpp
@@ -0,0 +1,74 @@
+#ifndef FrameSnapshot_hpp
+#define FrameSnapshot_hpp
+#include "Enums.hpp"
+#include "LevelData.hpp"
+#include "Vector2d.hpp"
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+
+// A copy of everything displayed from the game area at a moment of the game:
+// the positions of the paddle and the balls (before and after the last
+// simulation step, so the displayed ones can be interpolated between them),
+// the blocks with their alive flags and the counters of the game. It is
+// filled by Arena::Capture() at the end of the simulation steps and can be
+// displayed while the arena itself is updated further (e.g. by another
+// thread). All the storage is fixed, so taking a snapshot allocates no memory.
+struct FrameSnapshot
+{
+  // maximum number of balls in the snapshot
+  static constexpr std::size_t max_balls = 32;
+  // maximum number of blocks in the snapshot (the whole lattice filled)
+  static constexpr std::size_t max_blocks
+      = LevelData::row_size * LevelData::max_rows;
+
+  // a block of the level
+  struct Block
+  {
+    // position of the block centre
+    float x;
+    float y;
+    // sprite used for displaying the block
+    Sprite sprite;
+  };
+
+  // position of the paddle centre before the last simulation step
+  gMath::Vector2d previous_paddle;
+  // position of the paddle centre
+  gMath::Vector2d paddle;
+  // positions of the centres of the balls in play before the last simulation
+  // step
+  std::array<gMath::Vector2d, max_balls> previous_balls;
+  // positions of the centres of the balls in play
+  std::array<gMath::Vector2d, max_balls> balls;
+  // number of the balls in play
+  std::size_t ball_count = 0;
+  // all the blocks of the level, destroyed ones included
+  std::array<Block, max_blocks> blocks;
+  // number of the blocks of the level
+  std::size_t block_count = 0;
+  // flags of the blocks not yet destroyed
+  std::bitset<max_blocks> block_alive;
+  // generation of the blocks (see BlockField::Generation()); changes when the
+  // blocks are replaced by a new level
+  unsigned block_generation = 0;
+  // current level number
+  unsigned level = 0;
+  // points achieved by the player
+  unsigned total_points = 0;
+  // number of remaining lives (balls)
+  unsigned balls_remaining = 0;
+
+  // the moment the snapshot was taken; set by the owner of the simulation
+  // clock, not by Arena::Capture()
+  std::chrono::steady_clock::time_point time;
+  // part of the next simulation step (0 to 1) already accumulated when the
+  // snapshot was taken; set together with the time
+  float step_fraction = 0.0f;
+  // the info screen halting the game when the snapshot was taken, displayed
+  // with the values of the snapshot; set together with the time
+  Interlude interlude = Interlude::None;
+};
+
+#endif // !FrameSnapshot_hpp
@@ -1,48 +1,81 @@
 #ifndef GAME_HPP
 #define GAME_HPP
+#include "Arena.hpp"
+#include "ArenaView.hpp"
+#include "AssetLoader.hpp"
 #include "AudioMixer.hpp"
-#include "Ball.hpp"
-#include "Block.hpp"
+#include "Autopilot.hpp"
 #include "Controller.hpp"
+#include "DrawList.hpp"
+#include "FrameSnapshot.hpp"
+#include "FramePacer.hpp"
+#include "FrameRecorder.hpp"
+#include "Hud.hpp"
+#include "InfoScreen.hpp"
 #include "IntervalTimer.hpp"
-#include "LevelData.hpp"
-#include "Paddle.hpp"
-#include "RandNum.hpp"
 #include "Renderer.hpp"
 #include "SDLInitializers.hpp"
-#include "SideWall.hpp"
-#include "TextElement.hpp"
-#include "Texture.hpp"
+#include "SpriteAtlas.hpp"
+#include "TextEngine.hpp"
+#include "TripleBuffer.hpp"
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
 #include <vector>
 
 // class forward declarations
 class Controller;
 class SDLinitializer;
 
-// main game class
-class Game
+// Main game class; the SDL front-end (display, sound and keyboard input) of
+// the game core represented by the Arena. The game runs on two threads: the
+// main thread handles the input and displays the frames, while the simulation
+// thread updates the arena at the fixed simulation rate. The simulation
+// publishes a snapshot of the arena after every update through a lock-free
+// triple buffer and the main thread displays the latest one, so neither of
+// them ever waits for the other (e.g. for presenting a frame with vsync). The
+// arena is accessed only by the simulation thread; the commands of the player
+// are queued for it and the game state is shared as an atomic value
+class Game : public ArenaListener
 {
   public:
-  // Constructor. Takes game window height and width, desired FPS rate and
-  // numbers off game levels implemented.
+  // Constructor. Takes game window height and width, desired FPS rate,
+  // simulation tick rate (fixed updates per second), numbers off game
+  // levels implemented, the mode of rendering and the seed of the random
+  // numbers used in the game. In the offscreen mode the game is played by the
+  // autopilot (and restarted when over), as there is no player watching it,
+  // and simulated in lockstep with the rendered frames, so the same seed
+  // always gives the same frames.
   // Subobjects will throw exceptions if initialization fails (SDLexception and
   // exceptions derived from std::exception)
   Game(const std::size_t screenHeight, const std::size_t screenWidth,
-      const std::size_t targetFrameRate, unsigned levelsImplemented);
+      const std::size_t targetFrameRate, const std::size_t simulationRate,
+      unsigned levelsImplemented, RenderMode renderMode, std::uint64_t seed);
 
-  // RAII mechanism allow to use defalut destructor
-  ~Game() = default;
+  // stops the simulation thread; the rest of the resources is released by
+  // RAII
+  ~Game() override;
 
   // deleted copy operations as the project design predicts only one game object
   // in the entire program and many objects are handled by unique pointers
   Game(const Game&) = delete;
   Game& operator=(const Game&) = delete;
 
-  // runs the game; implements main game loop
-  void Run();
+  // Runs the game; implements main game loop. Stops after the given number of
+  // frames, unless it is 0. Rethrows the exception which stopped the
+  // simulation thread, if any
+  void Run(std::size_t maxFrames = 0);
+  // Records the displayed frames to the given path in the given format (see
+  // FrameRecorder) from now on. Throws std::runtime_error if the video file
+  // can't be created
+  void Record(const std::string& path, CaptureFormat format);
   // quits the game by stopping the main loop
   void Quit() { is_running_ = false; }
   // Restarts the game
@@ -51,59 +84,96 @@ class Game
   void TogglePause();
   // returns game state, that is the current bahaviour mode
   GameState State() const { return state_; }
-  // handles the ball leaving the allowed screen area
-  void HandleBallEscape();
-  // handles a block being hit by the ball
-  void HandleBlockHit(Block& block);
-  // returns the speed increment applied every time the
-  // user orders so
-  float SpeedIncrement() const { return speed_increment_; };
+  // queues the command of the player to be applied by the simulation; a
+  // command repeating the last queued one is coalesced with it
+  void PostCommand(PlayerCommand command);
+  // reacts to the events happening in the arena (sounds and info screens);
+  // called on the simulation thread
+  void OnEvent(const EventRecord& event) override;
   // replays the sound corresponding to the sound enum code
   void PlaySound(Sound sound) const { audio_->PlaySound(sound); }
+  // forces redrawing of the graphics cached in render targets, whose contents
+  // may be lost (e.g. when the graphics device is reset)
+  void InvalidateCachedGraphics() { arena_view_->InvalidateLayer(); }
 
   private:
-  // Perfoms actions in routine game state
-  void RoutineGameActions();
-  // Perfoms actions when the game is paused
-  void PausedGameActions();
-  // Loads new level. Returns true if new level loaded successfully,
-  // false if the current level was the last one implemented
-  bool LoadNewLevel(unsigned newLevel);
-  // updates the state of the game objects
-  void UpdateGame();
+  // SIMULATION THREAD: the loop updating the arena until the game quits
+  void RunSimulation();
+  // SIMULATION THREAD (the main thread in lockstep): a single update of the
+  // simulation; restarts the game if requested, applies the commands of the
+  // player and runs the simulation steps due, unless the simulation is halted
+  void UpdateSimulation();
+  // SIMULATION THREAD: applies the commands of the player queued since the
+  // previous update
+  void ApplyCommands();
+  // SIMULATION THREAD: drops the commands of the player posted while the
+  // simulation is halted, so they are not replayed at once when it resumes
+  void DiscardCommands();
+  // SIMULATION THREAD: runs as many fixed simulation steps as the time
+  // accumulated since the previous update allows (limited by
+  // max_steps_per_frame_), or the steps of a frame in lockstep, and loads the
+  // next level if the current one was cleared
+  void RunSimulationSteps();
+  // SIMULATION THREAD: runs up to the given number of fixed simulation steps
+  // and returns the number of steps made. Stops early if a ball was lost, so
+  // the info screen is shown right away
+  unsigned RunFixedSteps(unsigned steps);
+  // SIMULATION THREAD: returns the time of the simulation clock: the real
+  // time, or the time of the frames simulated in lockstep
+  std::chrono::steady_clock::time_point SimulationNow() const;
+  // SIMULATION THREAD: drops the time accumulated by the simulation, e.g.
+  // after the simulation was halted for displaying an info screen
+  void ResetSimulationClock();
+  // SIMULATION THREAD: halts the simulation for the time of displaying the
+  // info screen
+  void StartInterlude(Interlude interlude);
+  // SIMULATION THREAD: checks if the simulation is halted by an info screen
+  bool IsInterludeRunning();
+  // SIMULATION THREAD: publishes the snapshot of the arena to be displayed
+  void PublishSnapshot();
+  // stops the simulation thread and waits until it finishes
+  void StopSimulation();
+  // prints the number and the hash of the rendered frame to the standard
+  // output
+  void ReportFrameHash(std::size_t frame) const;
+  // Returns the part (0 to 1) of the simulation step from the previous to the
+  // current positions of the snapshot displayed now. The displayed positions
+  // are one step behind the simulation, so they can always be interpolated
+  float InterpolationAlpha(const FrameSnapshot& snapshot) const;
+
+  // Displays the game screen (or the info screen halting the game) with the
+  // positions of the movable objects interpolated at the given alpha
+  void DisplayGameScreen(const FrameSnapshot& snapshot, float alpha);
   // Displays the pause screen when the game is paused
-  void DisplayPauseScreen() const;
+  void DisplayPauseScreen(const FrameSnapshot& snapshot);
   // Displays the screen after ball leaving the screen
-  void DisplayBallLostScreen() const;
+  void DisplayBallLostScreen(const FrameSnapshot& snapshot);
   // Displays the screen after the level has been completed
-  void DisplayLevelCompleted() const;
+  void DisplayLevelCompleted(const FrameSnapshot& snapshot);
   // Displays the screen after all lives/balls have been lost
-  void DisplayGameOverScreen() const;
+  void DisplayGameOverScreen(const FrameSnapshot& snapshot);
   // Displays the screen when the game is won
-  void DisplayGameWonScreen() const;
-  // load all image textures used in the game
+  void DisplayGameWonScreen(const FrameSnapshot& snapshot);
+  // loads all the images used in the game into the sprite atlas
   void LoadImages();
   // Initializes audio mixer system and loads all the sound
-  // effects to be used in the game
+  // effects to be used in the game; uses no renderer, so it may run on
+  // another thread
   void LoadAudio();
-  // gets a single image texture from the stored textures
-  const Texture& GetTexture(Sprite sprite) const;
-  // creates all the texts which won't change for entire game
-  void CreateTexts();
-  // creates the wall limiting the game area
-  void CreateWalls();
-  // creates the top wall
-  void CreateTopWall();
-  // creates the left wall
-  void CreateLeftWall();
-  // creates the right wall
-  void CreateRightWall();
-  // creates the ball
-  void CreateBall();
-  // creates the paddle
-  void CreatePaddle();
-  // creates blocks
-  void CreateBlocks();
+  // builds the pause screen: the game title, the game controls and the
+  // counters of balls, level and score
+  void CreatePauseScreen();
+  // builds the screen displayed after ball leaving the screen
+  void CreateBallLostScreen();
+  // builds the screen displayed after the level has been completed
+  void CreateLevelCompletedScreen();
+  // builds the screen displayed after all lives/balls have been lost
+  void CreateGameOverScreen();
+  // builds the screen displayed when the game is won
+  void CreateGameWonScreen();
+  // describes the game area and its objects using the sizes of the loaded
+  // sprites
+  ArenaLayout CreateLayout() const;
 
   // RAII class object responsible for initializing and closing SDL subsystems
   SDLinitializer sdl_initializer_;
@@ -112,50 +182,104 @@ class Game
   ImageInitializer image_initializer_;
   // RAII class object responsible for initializing and True Type Font support
   TTFinitializer ttf_initializer_;
+  // reads the assets from the asset pack (or their files); declared before
+  // all the objects using the assets, as the fonts keep reading them
+  AssetLoader assets_;
   // window size properties
   const std::size_t screen_height_;
   const std::size_t screen_width_;
   // unique pointer to renderer
   std::unique_ptr<Renderer> renderer_;
-  // number levels implemented by the developer
-  unsigned max_level_;
-  // controls if the main loop is running
-  bool is_running_ = true;
-  // controlls the bahaviour of main loop
-  GameState state_ = GameState::Paused;
+  // pointer to the recorder of the displayed frames; empty if the frames are
+  // not recorded
+  std::unique_ptr<FrameRecorder> recorder_;
+  // controls if the main loop and the simulation loop are running
+  std::atomic<bool> is_running_ { true };
+  // controlls the bahaviour of main loop and the simulation; shared by both
+  // threads
+  std::atomic<GameState> state_ { GameState::Paused };
+  // set by the main thread to make the simulation restart the game
+  std::atomic<bool> restart_requested_ { false };
   // target frame rate of the display
-  const Uint32 frame_rate_;
-  // speed increase applied when the user orders so
-  const float speed_increment_ = 30.0f;
-  // container with all image textures used in the game
-  std::unordered_map<Sprite, Texture> images_;
-  // container with texts constructed once for the entire game duration
-  std::vector<TextElement> texts_;
+  const std::size_t frame_rate_;
+  // keeps the main loop at the target frame rate and measures frame jitter
+  FramePacer frame_pacer_;
+  // number of simulation steps per second
+  const std::size_t simulation_rate_;
+  // duration of a single simulation step in seconds (1 / simulation rate)
+  const float fixed_time_step_;
+  // if true, the main thread runs the simulation steps of every frame before
+  // rendering it (offscreen), instead of the simulation thread running them
+  // in real time
+  const bool lockstep_;
+  // keeps the simulation loop at the simulation rate
+  FramePacer simulation_pacer_;
+  // time the info screens halt the game for
+  const std::chrono::milliseconds interlude_duration_ { 4000 };
+  // maximum number of simulation steps run for a single update; limits the
+  // catch-up work after a long halt so the game cannot spiral
+  const unsigned max_steps_per_frame_ = 16;
+  // real time (seconds) accumulated and not yet consumed by the simulation
+  float time_accumulator_ = 0.0f;
+  // single texture with all the sprite images used in the game
+  std::unique_ptr<SpriteAtlas> atlas_;
+  // fonts and glyphs cached for drawing all the texts of the game
+  std::unique_ptr<TextEngine> text_engine_;
+  // info screens built once for the entire game duration and updated only
+  // when the values they display change
+  InfoScreen pause_screen_;
+  InfoScreen ball_lost_screen_;
+  InfoScreen level_completed_screen_;
+  InfoScreen game_over_screen_;
+  InfoScreen game_won_screen_;
+  // the values displayed on the info screens
+  InfoScreen::ValueId pause_balls_ = 0;
+  InfoScreen::ValueId pause_level_ = 0;
+  InfoScreen::ValueId pause_score_ = 0;
+  InfoScreen::ValueId lost_balls_ = 0;
+  InfoScreen::ValueId completed_level_ = 0;
+  InfoScreen::ValueId completed_score_ = 0;
+  InfoScreen::ValueId over_score_ = 0;
+  InfoScreen::ValueId won_score_ = 0;
   // pointer to AudioMixer responsible for sound support
   std::unique_ptr<AudioMixer> audio_;
   // pointer to controller for handling keyboard input
   std::unique_ptr<Controller> controller_;
-  // container for side walls
-  std::vector<SideWall> side_walls_;
-  // pointer to the ball
-  std::unique_ptr<Ball> ball_;
-  // pointer to the paddle
-  std::unique_ptr<Paddle> paddle_;
-  // container of all the blocks in the current level
-  std::vector<Block> blocks_;
-  // Containers grouping all the static and movable objects to be displayed on
-  // the game screen. (for display purposes only, objects are managed by other
-  // members)
-  std::vector<const StaticObject*> static_for_game_screen_;
-  std::vector<const MovableObject*> movable_for_game_screen_;
-  // takes track of points achieved by the player
-  unsigned total_points_ = 0;
-  // inlcudes all the current level data
-  std::unique_ptr<LevelData> level_data_;
-  // number of remaining lives (balls) before "game over"
-  unsigned balls_remaining_;
-  // timer regulating the updates of the game state
+  // pointer to the game core: the game area with all its objects and rules
+  std::unique_ptr<Arena> arena_;
+  // pointer to the displayable representation of the game area
+  std::unique_ptr<ArenaView> arena_view_;
+  // pointer to the counters displayed on the game screen
+  std::unique_ptr<Hud> hud_;
+  // the commands drawing the current frame; refilled every frame
+  DrawList draw_list_;
+  // the commands of the player waiting for the simulation; guarded by
+  // commands_mutex_
+  std::vector<PlayerCommand> pending_commands_;
+  std::mutex commands_mutex_;
+  // SIMULATION THREAD: the commands being applied (swapped with the pending
+  // ones, so neither of the buffers is reallocated)
+  std::vector<PlayerCommand> applied_commands_;
+  // SIMULATION THREAD: timer regulating the updates of the game state
   IntervalTimer timer_;
+  // SIMULATION THREAD: steers the paddle when there is no player (offscreen
+  // rendering); empty otherwise
+  std::optional<Autopilot> autopilot_;
+  // SIMULATION THREAD: indicates if the previous update ran the simulation
+  bool was_simulating_ = false;
+  // SIMULATION THREAD: number of the frames simulated in lockstep; the clock
+  // of the lockstep simulation
+  std::size_t lockstep_frames_ = 0;
+  // SIMULATION THREAD: the info screen halting the game and the end of it
+  Interlude interlude_ = Interlude::None;
+  std::chrono::steady_clock::time_point interlude_end_;
+  // snapshots of the arena passed from the simulation to the main thread
+  TripleBuffer<FrameSnapshot> snapshots_;
+  // the exception which stopped the simulation thread
+  std::exception_ptr simulation_error_;
+  // the thread updating the arena; stopped by the destructor before any of
+  // the members it uses is destroyed
+  std::thread simulation_thread_;
 };
 
 #endif // !GAME_HPP
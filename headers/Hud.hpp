@@ -0,0 +1,51 @@
+#ifndef Hud_HPP
+#define Hud_HPP
+#include "DrawList.hpp"
+#include "FrameSnapshot.hpp"
+#include "SDL.h"
+#include "TextEngine.hpp"
+#include <string_view>
+
+// Heads-up display of the game screen: the level (on the left), the total
+// score (in the middle) and the balls remaining (on the right) displayed in
+// a row at the bottom of the screen, behind the game objects. The counters
+// are read from the snapshot of the arena every frame and written into a
+// fixed buffer, and all the characters used are rendered and the labels
+// measured when the HUD is created, so drawing it neither formats strings nor
+// allocates memory nor creates textures, and measures only the values.
+class Hud
+{
+  public:
+  // Constructor. Takes the text engine used for drawing, the width of the
+  // screen and the vertical position of the HUD. May throw SDLexception if
+  // opening the font or rendering its glyphs fails
+  Hud(TextEngine& textEngine, float screenWidth, float y);
+
+  // adds the commands displaying the counters of the snapshot to the draw
+  // list
+  void Draw(DrawList& drawList, const FrameSnapshot& snapshot) const;
+
+  private:
+  // adds the commands displaying the label (of the given width) followed by
+  // the value, starting at the given x coordinate, to the draw list
+  void DrawCounter(DrawList& drawList, std::string_view label,
+      int labelWidth, std::string_view value, SDL_Color color,
+      int left) const;
+
+  // NOT OWNED engine drawing the texts
+  TextEngine& text_engine_;
+  // font of the texts
+  TextEngine::FontId font_;
+  // width of the screen
+  float screen_width_;
+  // vertical position of the tops of the texts
+  int top_;
+  // widths of the labels of the counters
+  int level_label_width_;
+  int score_label_width_;
+  int balls_label_width_;
+  // horizontal distance of the side counters from the edges of the screen
+  static constexpr float margin = 40.0f;
+};
+
+#endif // !Hud_HPP
@@ -0,0 +1,69 @@
+#ifndef InfoScreen_HPP
+#define InfoScreen_HPP
+#include "DrawList.hpp"
+#include "SDL.h"
+#include "TextElement.hpp"
+#include "TextEngine.hpp"
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <vector>
+
+// A screen of texts displayed over many frames (e.g. the pause screen). The
+// screen is built once and kept for the entire game; the texts showing values
+// of the game (e.g. the score) are bound to them and updated only when the
+// bound value changes, so displaying the screen again and again does no text
+// formatting and no layout work.
+class InfoScreen
+{
+  public:
+  // identifies a text bound to a value
+  using ValueId = std::size_t;
+
+  // Constructor. Takes the text engine used by all the texts of the screen
+  explicit InfoScreen(TextEngine& textEngine);
+
+  // adds a text which never changes and returns it (e.g. for further layout).
+  // Takes: x,y coordinates of the text on the screen, path of the font file,
+  // color of text, size of text (pixels) and the text itself.
+  // May throw SDLexception if opening the font or rendering its glyphs fails
+  const TextElement& AddText(float x, float y, const std::string& fontPath,
+      SDL_Color color, int textSize, const std::string& text);
+  // Adds a text displaying a value preceded by the prefix (e.g. "LEVEL ")
+  // and returns its identifier. The value is displayed after the first call
+  // of SetValue(). Takes the same arguments as AddText(), except the text.
+  // May throw SDLexception if opening the font fails
+  ValueId AddValue(float x, float y, const std::string& fontPath,
+      SDL_Color color, int textSize, const std::string& prefix = "");
+  // Sets the value of the bound text, updating the text only if the value
+  // differs from the displayed one. May throw SDLexception if rendering
+  // glyphs fails
+  void SetValue(ValueId id, unsigned value);
+
+  // adds the commands displaying all the texts of the screen to the draw list
+  void Draw(DrawList& drawList) const;
+
+  private:
+  // a text bound to a value of the game
+  struct BoundValue
+  {
+    // the text displaying the value
+    TextElement* text;
+    // text displayed before the value
+    std::string prefix;
+    // the displayed value
+    unsigned value;
+    // indicates if any value has been displayed yet
+    bool is_set;
+  };
+
+  // NOT OWNED engine drawing the texts
+  TextEngine& text_engine_;
+  // all the texts of the screen; deque doesn't move its elements when growing,
+  // so the pointers to them stay valid
+  std::deque<TextElement> texts_;
+  // the texts bound to values
+  std::vector<BoundValue> values_;
+};
+
+#endif // !InfoScreen_HPP
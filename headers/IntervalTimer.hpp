@@ -1,7 +1,7 @@
 #ifndef IntervalTimer_HPP
 #define IntervalTimer_HPP
 
-#include "SDL.h"
+#include <chrono>
 
 // class allowing measuring interval of times
 class IntervalTimer
@@ -17,13 +17,14 @@ class IntervalTimer
   // pauses the timer
   void Pause() { paused_ = true; };
 
-  // constant describing how many SDL clock ticks has each second
-  static constexpr float ticks_per_second = 1000.0f;
-
   private:
-  Uint32 previous_time_;
-  Uint32 current_time_;
+  // monotonic clock used for measurements; doesn't depend on SDL, so the
+  // timer can be used by the game core as well
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point previous_time_;
+  Clock::time_point current_time_;
   // indicates if the timer is paused
   bool paused_;
 };
-#endif // !IntervalTimer_HPP
\ No newline at end of file
+#endif // !IntervalTimer_HPP
@@ -1,8 +1,10 @@
 #ifndef LevelData_HPP
 #define LevelData_HPP
+#include "AssetPack.hpp"
 #include "Enums.hpp"
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // loads and represents level data: ball speed, paddle speed, player lives
@@ -11,9 +13,12 @@
 class LevelData
 {
   public:
-  // constructor taking the path to levels to load and level number
-  // throws std::runtime_error if unable to load level data
-  LevelData(const std::string& path, unsigned levelNumber = 1);
+  // Constructor taking the path to levels to load, level number and the asset
+  // pack to read the level file from (if the pack contains it; the file is
+  // read from the disk otherwise).
+  // Throws std::runtime_error if unable to load level data
+  LevelData(const std::string& path, unsigned levelNumber = 1,
+      const AssetPack* assets = nullptr);
   // returns minimum scalar speed of the ball (pixels/second) for the level
   float BallSpeed() const { return ball_speed_; }
   // returns paddle scalar speed for the level;
@@ -39,21 +44,19 @@ class LevelData
   static constexpr float block_height = 25.0f;
 
   private:
-  // Reads and returns single value described by key from the file.
+  // Reads and returns single value described by key from the level text.
   // If the value wasn't found returns default value for the type.
-  // Throws std::runtime_error if was unable to open file
   template <typename T>
-  T ReadDataItem(const std::string& filePath, const std::string& keyword) const;
-  // reads all level numerical data from the level file
+  T ReadDataItem(std::string_view levelText, const std::string& keyword) const;
+  // reads all level numerical data from the level text
   // returns true if succesfull, false - otherwise
-  bool ReadNumericalData(const std::string& filePath);
-  // Parses the given file and tries to create and fill member sprite table,
-  // where each object of enum type Sprite corresponds to one block. In the file
-  // however, each block is represented by single character, so the function
-  // maps the char into Sprite while reading.
+  bool ReadNumericalData(std::string_view levelText);
+  // Parses the given level text and tries to create and fill member sprite
+  // table, where each object of enum type Sprite corresponds to one block. In
+  // the file however, each block is represented by single character, so the
+  // function maps the char into Sprite while reading.
   // Returns true if sprite table is created succesfully, false otherwise.
-  // Throws std::runtime_error if was unable to open file
-  bool ReadSpriteTable(const std::string& filePath);
+  bool ReadSpriteTable(std::string_view levelText);
   // loads single row of sprites; helper for ReadSpriteTable()
   std::vector<Sprite> ReadSpriteRow(const std::string& fileLine) const;
   // maps a single char (read from file) into sprite type
@@ -15,12 +15,16 @@ class MovableObject
   virtual ~MovableObject() = default;
   // updates object state
   virtual void Update(float deltaTime) = 0;
-  // draws the object
-  virtual void Draw() const = 0;
   // gets object position
   virtual gMath::Vector2d Position() const { return position_; };
-  // sets object position
+  // sets object position; the object is moved there at once, so it is not
+  // interpolated from its previous position
   virtual void SetPosition(float x, float y);
+  // gets object position at the start of the current simulation step
+  gMath::Vector2d PreviousPosition() const { return previous_position_; }
+  // marks the start of a simulation step: the current position becomes the
+  // previous one, from which the displayed position is interpolated
+  void KeepPreviousPosition() { previous_position_ = position_; }
   // gets current speed of the object;
   virtual float Speed() const { return _speed; }
   // sets the scalar speed of the object;
@@ -29,7 +33,9 @@ class MovableObject
   protected:
   // object position
   gMath::Vector2d position_;
+  // object position at the start of the current simulation step
+  gMath::Vector2d previous_position_;
   // objects scalar speed
   float _speed;
 };
-#endif // !MovableObject_hpp
\ No newline at end of file
+#endif // !MovableObject_hpp
@@ -1,42 +1,37 @@
 #ifndef Paddle_hpp
 #define Paddle_hpp
 
+#include "Collision.hpp"
 #include "MovableObject.hpp"
-#include "Texture.hpp"
 #include "Vector2d.hpp"
 
-// Texture forward declaration
-class Texture;
-
-// Constructor:
-// X, Y - paddle centre coordinates
-// speed - ball scalar speed in pixels / second
-// moveLimits - invisible rectangle within the paddle can move
-// texture - texture used for displaying the ball.
-// Throws std::invalid_argument if passed values don't allow to create the
-// Paddle
+// class representing the paddle steered by the player
 class Paddle : public virtual MovableObject
 {
   public:
   // Constructor:
   // X, Y - paddle centre coordinates
-  // speed - ball scalar speed in pixels / second
+  // speed - paddle scalar speed in pixels / second
   // moveLimits - invisible rectangle within the paddle can move
-  // texture - texture used for displaying the ball
-  Paddle(float x, float y, float speed, SDL_Rect moveLimits,
-      const Texture& texture);
+  // halfWidth, halfHeight - half of the paddle size
+  // Throws std::invalid_argument if passed values don't allow to create the
+  // Paddle
+  Paddle(float x, float y, float speed, gMath::Rect moveLimits,
+      float halfWidth, float halfHeight);
 
   // default virtual destructor
   ~Paddle() override = default;
 
   // update paddle state
   void Update(float deltaTime) override;
-  // render the paddle
-  void Draw() const override;
   // returns half of the paddle height
   float HalfHeight() const { return half_height_; }
   // returns half of the paddle width
   float HalfWidth() const { return half_width_; }
+  // returns paddle vector of velocity (pixels / second)
+  gMath::Vector2d Velocity() const { return velocity_; }
+  // returns the rectangle within the paddle can move
+  const gMath::Rect& MoveLimits() const { return move_limits_; }
   // stops the paddle by setting velocity vector to {0,0}
   void Stop();
   // enables moving up by proper setting of the paddle velocity vector
@@ -55,9 +50,7 @@ class Paddle : public virtual MovableObject
   // paddle velocity vector
   gMath::Vector2d velocity_;
   // invisible moving limits rectangle
-  SDL_Rect move_limits_;
-  // texture used for displaying the ball
-  const Texture& texture_;
+  gMath::Rect move_limits_;
   // storing below values spares many repeated calculations while collision
   // detection and process of keeping the paddle within allowed moving limits
   const float half_height_;
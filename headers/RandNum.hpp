@@ -1,60 +1,79 @@
 #ifndef RandNum_hpp
 #define RandNum_hpp
 
-#include <random>
+#include <cstdint>
+#include <type_traits>
 
 // namespace for grouping objects and functions required for the game
 // calculations
 namespace gMath {
 
-// class for getting random numbers
+// Class for getting random numbers. Every object is an independent stream of
+// random numbers generated by a small and fast xoshiro128++ generator, so
+// objects used by different games (or threads) don't share any state. The
+// stream is fully determined by the seed, and the numbers are converted into
+// the requested ranges without the standard library distributions, so the
+// same seed gives the same numbers on every platform.
 class RandNum
 {
   public:
+  // Constructor. Takes the seed determining the whole stream of numbers
+  explicit RandNum(std::uint64_t seed);
+
   // Gets random integral or floating point number depending of parameter type.
   // For integral numbers returns number in range  min to max - both included
   // For floating-point numbers returns number in range from  min (included)) to
-  // max (excluded). Can be used both on instantiated objects of class and
-  // as a static member function as well. Works for various integral and
-  // floating point types.
-  // Because all of the data members are static objects, the user can create
-  // objects of the class where convenient whithout excessive cost
+  // max (excluded). Works for various integral and floating point types
+  // (integral ranges must fit into 32 bits).
   template <typename T>
-  static T Random(T min, const T max)
+  T operator()(T min, T max)
   {
+    static_assert(std::is_arithmetic_v<T>, "RandNum needs an arithmetic type");
     // if T is a integral type
     if constexpr (std::is_integral_v<T>) {
-      // define uniform integeral number distribution for the given range
-      std::uniform_int_distribution<T> distrib(min, max);
-      // get and return random number from distribution using engine
-      return distrib(engine);
+      // number of values in the range
+      const std::uint64_t range = static_cast<std::uint64_t>(max)
+          - static_cast<std::uint64_t>(min) + 1;
+      // map the 32 random bits onto the range by multiplication (the bias
+      // is negligible for the ranges used in the game)
+      return static_cast<T>(
+          static_cast<std::uint64_t>(min)
+          + ((static_cast<std::uint64_t>(Next()) * range) >> 32));
     }
     // if T is a floating point type
-    else if (std::is_floating_point_v<T>) {
-      // define uniform floating-point number distribution for the given
-      // range
-      std::uniform_real_distribution<T> distrib(min, max);
-      // get and return random number from distribution using engine
-      return distrib(engine);
-    }
-    // for unpredicted type return the default value type
     else {
-      return T {};
+      // 24 random bits give every float in [0,1) with equal step
+      const float unit = (Next() >> 8) * (1.0f / 16777216.0f);
+      return static_cast<T>(min + (max - min) * unit);
     }
   }
-  // Alternative function operator doing the same as Random() but on
-  // instantiated objects only
-  template <class T>
-  T operator()(T min, T max) const
+
+  // returns the next 32 random bits of the stream
+  std::uint32_t Next()
   {
-    return Random(min, max);
+    const std::uint32_t result = RotateLeft(state_[0] + state_[3], 7)
+        + state_[0];
+    const std::uint32_t shifted = state_[1] << 9;
+
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= shifted;
+    state_[3] = RotateLeft(state_[3], 11);
+
+    return result;
   }
 
   private:
-  // random device used for seeding the random engine
-  static std::random_device device;
-  // mersenne twister engine used for generating random numbers
-  static std::mt19937 engine;
+  // rotates the bits of the value left by k positions
+  static std::uint32_t RotateLeft(std::uint32_t value, int k)
+  {
+    return (value << k) | (value >> (32 - k));
+  }
+
+  // state of the xoshiro128++ generator
+  std::uint32_t state_[4];
 };
 
 } // end of namespace gMath
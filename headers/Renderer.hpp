@@ -1,21 +1,28 @@
 #ifndef RENDERER_HPP
 #define RENDERER_HPP
 
-#include "MovableObject.hpp"
+#include "DrawList.hpp"
+#include "Enums.hpp"
+#include "FramePacer.hpp"
+#include "FrameRecorder.hpp"
 #include "SDL.h"
-#include "StaticObject.hpp"
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <vector>
 
-// Class for rendering graphics to the screen.
+// Class for rendering graphics to the screen. In the offscreen mode the
+// frames are rendered by the software renderer into a surface in memory
+// instead of a window and never presented, so the whole rendering path runs
+// without a display; the frame can then be checked by its hash.
 class Renderer
 {
   public:
-  // Constructor. Takes screen size for rendering.
+  // Constructor. Takes screen size for rendering and the mode of rendering.
   // Throws std::ivalid_argument if the size is non-positive
   // Throws SDLexception if initializing SDL_Renderer will fail
-  Renderer(const std::size_t screenHeight, const std::size_t screenWidth);
+  Renderer(const std::size_t screenHeight, const std::size_t screenWidth,
+      RenderMode mode = RenderMode::Window);
 
   // copying of class object doesn't make sense and crucial resources are
   // managed with unique pointers, so copy operations are disabled
@@ -25,14 +32,25 @@ class Renderer
   // All resources are managed automatically, so default destructor is used
   ~Renderer() = default;
 
-  // displays (renders) game graphics composed of the passed arguments:
-  // a vector of static (non-movable) and a vector of movable objects
-  void DisplayScreen(const std::vector<const StaticObject*>& staticObjects,
-      const std::vector<const MovableObject*>& movableObjects) const;
+  // Displays a screen drawn by the commands of the draw list sent as
+  // argument; the list is emptied
+  void DisplayScreen(DrawList& drawList) const;
 
-  // Displays a screen containing static (non-movable) objects sent as argument
-  void DisplayScreen(
-      const std::vector<const StaticObject*>& staticObjects) const;
+  // displays the frame rate and frame time statistics in the window title bar
+  // (printed to the standard output in the offscreen mode)
+  void ShowFrameStats(const FrameStats& stats) const;
+
+  // Sets the recorder capturing every displayed frame before it is
+  // presented; nullptr stops capturing. The recorder is NOT OWNED and must
+  // outlive its use by the renderer
+  void SetRecorder(FrameRecorder* recorder) { recorder_ = recorder; }
+
+  // checks if the frames are rendered offscreen
+  bool IsOffscreen() const { return mode_ == RenderMode::Offscreen; }
+  // Returns the 64-bit FNV-1a hash of the pixels of the last displayed frame,
+  // so frames can be compared without storing them. Available only in the
+  // offscreen mode; returns 0 otherwise
+  std::uint64_t FrameHash() const;
 
   // returns a raw pointer to SDL renderer, which can be used if needed with SDL
   // functions. User of the class should not explicitly destroy or modify the
@@ -40,17 +58,28 @@ class Renderer
   SDL_Renderer* GetSDLrenderer() const { return sdl_renderer_.get(); }
 
   private:
-  // updates game window title bar
-  void UpdateTitleBar() const;
+  // creates the window and the hardware renderer presenting to it
+  void CreateWindowRenderer();
+  // creates the surface and the software renderer drawing into it
+  void CreateOffscreenRenderer();
 
   // game window size
   const std::size_t screen_height_;
   const std::size_t screen_width_;
+  // where the frames are rendered
+  const RenderMode mode_;
 
-  // unique pointer to SDL_Window using a custom window deleter.
+  // unique pointer to SDL_Window using a custom window deleter; empty in the
+  // offscreen mode
   std::unique_ptr<SDL_Window, std::function<void(SDL_Window*)>> sdl_window_;
+  // unique pointer to the surface the frames are rendered into in the
+  // offscreen mode, using a custom surface deleter
+  std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface*)>> surface_;
   // unique pointer to SDL_renderer using a custom renderer deleter
   std::unique_ptr<SDL_Renderer, std::function<void(SDL_Renderer*)>>
       sdl_renderer_;
+  // NOT OWNED pointer to the recorder of the frames; nullptr if the frames
+  // are not recorded
+  FrameRecorder* recorder_ = nullptr;
 };
 #endif // !RENDERER_HPP
\ No newline at end of file
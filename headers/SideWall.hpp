@@ -1,37 +1,36 @@
 #ifndef SideWall_HPP
 #define SideWall_HPP
 #include "Enums.hpp"
-#include "SDL.h"
-#include "StaticObject.hpp"
-#include "Texture.hpp"
-
-// forward declaration
-class Texture;
+#include "Vector2d.hpp"
 
 // class representing border walls in the game
-class SideWall : public virtual StaticObject
+class SideWall
 {
   public:
-  // constructor creating the Wall
-  SideWall(float x, float y, ScreenSide sideOfScreen, const Texture& texture,
-      float halfTickness);
-  // default virtual constructor
-  ~SideWall() override = default;
-  // renders the sideWall to the screen
-  void Draw() const override;
+  // Constructor creating the Wall. Takes x and y coordinates of the wall
+  // centre, the side of the screen the wall is placed on, half of the wall
+  // tickness and half of the wall length (measured along the screen side)
+  SideWall(float x, float y, ScreenSide sideOfScreen, float halfTickness,
+      float halfLength);
 
+  // gets the position of the wall centre
+  gMath::Vector2d Position() const { return position_; }
   // returns the side of the screen where the wall is placed
   ScreenSide GetScreenSide() const { return screen_side_; }
   // returns half of the wall tickness
   float HalfTickness() const { return half_tickness_; }
+  // returns half of the wall length (measured along the screen side)
+  float HalfLength() const { return half_length_; }
 
   private:
+  // position of the wall centre
+  gMath::Vector2d position_;
   // Side of the screen being placed
-  const ScreenSide screen_side_;
-  // texture representing the SideWall
-  const Texture& texture_;
+  ScreenSide screen_side_;
   // half of the wall tickness;
   // storing spares some calculations during collision detection
   float half_tickness_;
+  // half of the wall length; spares calculations during collision detection
+  float half_length_;
 };
-#endif // !SideWall_HPP
\ No newline at end of file
+#endif // !SideWall_HPP
@@ -0,0 +1,58 @@
+#ifndef SpriteAtlas_HPP
+#define SpriteAtlas_HPP
+#include "AssetLoader.hpp"
+#include "Enums.hpp"
+#include "SDL.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// A single texture with all the sprite images of the game packed into it.
+// The images are loaded and packed once, at construction, and each sprite is
+// addressed as a sub-rectangle (region) of the atlas, so all the sprites can
+// be drawn from the same texture without switching between textures.
+class SpriteAtlas
+{
+  public:
+  // Constructor. Takes the sprites with the paths of their image files, the
+  // loader reading the images and the renderer for texture creation. Throws
+  // SDLexception if loading any of the images or creating the texture fails
+  SpriteAtlas(const std::vector<std::pair<Sprite, std::string>>& images,
+      const AssetLoader& assets, SDL_Renderer* gameRenderer);
+
+  // copying of class not predicted due to use of unique_ptr and no overall
+  // sense of copying, so copy operations are disabled
+  SpriteAtlas(const SpriteAtlas&) = delete;
+  SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+  // checks if the atlas contains the sprite
+  bool Contains(Sprite sprite) const;
+  // returns the region of the atlas occupied by the sprite (empty if the
+  // atlas doesn't contain the sprite)
+  const SDL_Rect& Region(Sprite sprite) const;
+
+  // gets atlas width
+  int Width() const { return width_; }
+  // gets atlas height
+  int Height() const { return height_; }
+  // returns pointer to SDL_Texture. Class SpriteAtlas owns the pointer,
+  // so user of the class should not explicitly destroy the texture
+  SDL_Texture* GetSDLtexture() const { return sdl_texture_.get(); }
+
+  private:
+  // empty space (pixels) left around every region, so the neighbouring
+  // images never bleed into each other when sampled
+  static constexpr int padding = 1;
+
+  // unique pointer to SDL texture with custom deleter
+  std::unique_ptr<SDL_Texture, std::function<void(SDL_Texture*)>> sdl_texture_;
+  // regions of the sprites indexed by the numeric value of the sprite
+  std::vector<SDL_Rect> regions_;
+  // atlas dimensions
+  int width_ = 0;
+  int height_ = 0;
+};
+
+#endif // !SpriteAtlas_HPP
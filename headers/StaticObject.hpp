@@ -2,7 +2,9 @@
 #define StaticObject_hpp
 #include "Vector2d.hpp"
 
-// abstract class for representing static (not moving objects in the game)
+// base class for representing static (not moving) objects displayed in the
+// game. The objects are displayed by adding draw commands to a DrawList with
+// their own (non-virtual) Draw functions
 class StaticObject
 {
   public:
@@ -12,8 +14,6 @@ class StaticObject
   StaticObject(float x, float y);
   // virutual destructor for handling inheritence
   virtual ~StaticObject() = default;
-  // draws the object
-  virtual void Draw() const = 0;
   // gets object position
   virtual gMath::Vector2d Position() const { return position_; };
 
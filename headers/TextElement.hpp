@@ -1,33 +1,44 @@
 #ifndef TextElement_HPP
 #define TextElement_HPP
-#include "Texture.hpp"
-#include <memory>
+#include "DrawList.hpp"
+#include "SDL.h"
+#include "StaticObject.hpp"
+#include "TextEngine.hpp"
 #include <string>
 
-// forward declaration
-class Texture;
-
-// simple class containing texture with text to display
+// simple class containing text to display
 struct TextElement : public StaticObject
 {
   public:
   // Constructor.
   // Takes: x,y coordinates of text element on the screen,
-  // path of the font file, color of text, size of text (pixels), SDL_renderer
-  // pointer (for texture creation and rendering) and the text to be displayed.
-  // May throw SDLexception if construction of member texture_ fails
+  // path of the font file, color of text, size of text (pixels), text engine
+  // (for font loading and rendering) and the text to be displayed.
+  // May throw SDLexception if opening the font or rendering its glyphs fails
   TextElement(float x, float y, const std::string& fontPath, SDL_Color color,
-      int textSize, SDL_Renderer* gameRenderer, const std::string& text);
+      int textSize, TextEngine& textEngine, const std::string& text);
+
+  // adds the commands displaying the text to the draw list
+  void Draw(DrawList& drawList) const;
 
-  // Displays text onto the screen
-  void Draw() const override;
+  // Replaces the displayed text, keeping the text element centred at the same
+  // position. May throw SDLexception if rendering glyphs fails
+  void SetText(const std::string& text);
 
   // Returns width of the text element
-  float Width() const { return texture_->Width(); }
+  float Width() const { return static_cast<float>(size_.x); }
 
   private:
-  // pointer to texture containing text to be displayed
-  std::unique_ptr<Texture> texture_;
+  // NOT OWNED engine drawing the text
+  TextEngine& text_engine_;
+  // font of the text
+  TextEngine::FontId font_;
+  // color of the text
+  SDL_Color color_;
+  // the text to be displayed
+  std::string text_;
+  // width and height of the displayed text
+  SDL_Point size_;
 };
 
 #endif // !TextElement_HPP
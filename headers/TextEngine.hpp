@@ -0,0 +1,113 @@
+#ifndef TextEngine_HPP
+#define TextEngine_HPP
+#include "AssetLoader.hpp"
+#include "DrawList.hpp"
+#include "Enums.hpp"
+#include "SDL.h"
+#include "SDL_ttf.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Draws texts with cached glyphs. Every font (file and size) is opened only
+// once and every character of it is rendered only once, on its first use,
+// into a shared glyph atlas (one or more page textures). A text is then drawn
+// as a row of draw commands copying the glyphs from the atlas, spaced by the
+// advances of the glyphs and the kerning of the font, and tinted with the
+// text colour. Displaying a text which changes every frame (e.g. a
+// counter) therefore opens no files, creates no textures and, once the glyphs
+// are rendered, allocates no memory.
+class TextEngine
+{
+  public:
+  // identifies a font opened by the engine
+  using FontId = std::size_t;
+
+  // Constructor. Takes the renderer used for texture creation and drawing and
+  // the loader reading the fonts (it must outlive the engine, as the fonts
+  // keep reading their streams)
+  TextEngine(SDL_Renderer* gameRenderer, const AssetLoader& assets);
+
+  // copying of class not predicted due to use of unique_ptr and no overall
+  // sense of copying, so copy operations are disabled
+  TextEngine(const TextEngine&) = delete;
+  TextEngine& operator=(const TextEngine&) = delete;
+
+  // Returns the font of the file with the given size (pixels), opening it on
+  // the first request. Throws SDLexception if opening the font fails
+  FontId Font(const std::string& fontPath, int textSize);
+  // returns the size (width and height) of the text displayed with the font.
+  // May throw SDLexception if rendering a glyph fails
+  SDL_Point Measure(FontId font, std::string_view text);
+  // adds the commands drawing the text centred at the given position within
+  // the layer to the draw list. May throw SDLexception if rendering a glyph
+  // fails
+  void Draw(DrawList& drawList, DrawLayer layer, FontId font,
+      std::string_view text, SDL_Color color, float centreX, float centreY);
+  // adds the commands drawing the text with its top-left corner at the given
+  // position within the layer to the draw list; unlike Draw() it doesn't
+  // measure the text. May throw SDLexception if rendering a glyph fails
+  void DrawAt(DrawList& drawList, DrawLayer layer, FontId font,
+      std::string_view text, SDL_Color color, int left, int top);
+  // renders the glyphs of all the characters in advance, so drawing texts
+  // made of them later doesn't render anything. May throw SDLexception if
+  // rendering a glyph fails
+  void Preload(FontId font, std::string_view characters);
+
+  private:
+  // a character of a font rendered into the atlas
+  struct Glyph
+  {
+    // index of the atlas page with the glyph
+    std::size_t page;
+    // region of the page with the rendered glyph
+    SDL_Rect region;
+    // horizontal offset of the region from the pen position
+    int offset_x;
+    // horizontal distance to the pen position of the next character
+    int advance;
+  };
+
+  // returns the glyph of the character, rendering it on its first use
+  const Glyph& GetGlyph(FontId font, Uint16 character);
+  // renders the glyph of the character into the atlas
+  Glyph RenderGlyph(FontId font, Uint16 character);
+  // adds an empty page to the atlas
+  void AddPage();
+
+  // side of the square atlas pages (pixels)
+  static constexpr int page_size = 1024;
+  // transparent margin around every glyph, so the neighbouring glyphs don't
+  // bleed into each other when scaled
+  static constexpr int padding = 1;
+
+  // NOT OWNED pointer to SDL renderer
+  SDL_Renderer* sdl_renderer_;
+  // the loader reading the fonts
+  const AssetLoader& assets_;
+  // opened fonts; unique pointers with custom deleter
+  std::vector<std::unique_ptr<TTF_Font, std::function<void(TTF_Font*)>>>
+      fonts_;
+  // identifiers of the opened fonts by file path and size
+  std::map<std::pair<std::string, int>, FontId> font_ids_;
+  // rendered glyphs by font and character
+  std::unordered_map<std::uint64_t, Glyph> glyphs_;
+  // pages of the atlas; glyphs are added to the last one. Unique pointers
+  // with custom deleter
+  std::vector<std::unique_ptr<SDL_Texture, std::function<void(SDL_Texture*)>>>
+      pages_;
+  // position of the next glyph on the current shelf (row) of the last page
+  int shelf_x_ = 0;
+  int shelf_y_ = 0;
+  // height of the current shelf
+  int shelf_height_ = 0;
+};
+
+#endif // !TextEngine_HPP
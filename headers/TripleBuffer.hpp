@@ -0,0 +1,65 @@
+#ifndef TripleBuffer_hpp
+#define TripleBuffer_hpp
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Lock-free exchange of values between a single writer thread and a single
+// reader thread. The writer fills its own (back) buffer and publishes it by
+// swapping it with the middle buffer; the reader takes the latest published
+// value by swapping its own (front) buffer with the middle one. Neither side
+// ever waits for the other: the writer can publish faster than the reader
+// reads (the values not read are skipped) and the reader keeps the last value
+// until a newer one is published.
+template <typename T>
+class TripleBuffer
+{
+  public:
+  TripleBuffer() = default;
+
+  // the buffers are shared between threads, so copy operations are disabled
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  // WRITER: returns the buffer to be filled before Publish()
+  T& WriteBuffer() { return buffers_[back_]; }
+  // WRITER: makes the filled buffer the latest value available to the reader
+  void Publish()
+  {
+    const std::uint8_t previous
+        = middle_.exchange(back_ | fresh_flag, std::memory_order_acq_rel);
+    back_ = previous & index_mask;
+  }
+
+  // READER: takes the latest published value, if there is a new one. Returns
+  // true if the read buffer changed
+  bool Update()
+  {
+    if ((middle_.load(std::memory_order_relaxed) & fresh_flag) == 0) {
+      return false;
+    }
+    const std::uint8_t previous
+        = middle_.exchange(front_, std::memory_order_acq_rel);
+    front_ = previous & index_mask;
+    return true;
+  }
+  // READER: returns the latest value taken by Update()
+  const T& ReadBuffer() const { return buffers_[front_]; }
+
+  private:
+  // marks the middle buffer as published and not yet taken by the reader
+  static constexpr std::uint8_t fresh_flag = 0x4;
+  // bits of the index of the buffer
+  static constexpr std::uint8_t index_mask = 0x3;
+
+  // the three buffers
+  std::array<T, 3> buffers_ {};
+  // index of the buffer owned by the writer
+  std::uint8_t back_ = 0;
+  // index of the buffer owned by the reader
+  std::uint8_t front_ = 1;
+  // index of the buffer being exchanged, with the fresh flag
+  std::atomic<std::uint8_t> middle_ { 2 };
+};
+
+#endif // !TripleBuffer_hpp
@@ -1,5 +1,6 @@
 #ifndef Vector2d_hpp
 #define Vector2d_hpp
+#include <algorithm>
 #include <cmath>
 
 // namespace for grouping objects and functions required for the game
@@ -11,26 +12,82 @@ class Vector2d
 {
   public:
   // default constructor
-  Vector2d();
+  constexpr Vector2d()
+      : x_(0.0f)
+      , y_(0.0f)
+  {
+  }
   // constructor taking X and Y coordinates
-  Vector2d(float X, float Y);
+  constexpr Vector2d(float X, float Y)
+      : x_(X)
+      , y_(Y)
+  {
+  }
   // constructor creating unit vector from the direction angle in radians
   explicit Vector2d(float angle);
 
   // Returns the x component of the vector
-  float X() const { return x_; }
+  constexpr float X() const { return x_; }
   // Returns the y component of the vector
-  float Y() const { return y_; }
+  constexpr float Y() const { return y_; }
 
   // Sets the x component of the vector
-  void SetX(float x) { x_ = x; }
+  constexpr void SetX(float x) { x_ = x; }
   // Sets the y component of the vector
-  void SetY(float y) { y_ = y; }
+  constexpr void SetY(float y) { y_ = y; }
 
   // returns current vector multiplied by scalar
-  Vector2d operator*(float scalar);
+  constexpr Vector2d operator*(float scalar) const
+  {
+    return Vector2d(x_ * scalar, y_ * scalar);
+  }
+  // returns current vector divided by scalar
+  constexpr Vector2d operator/(float scalar) const
+  {
+    return Vector2d(x_ / scalar, y_ / scalar);
+  }
+  // returns sum of the current and other vector
+  constexpr Vector2d operator+(const Vector2d& other) const
+  {
+    return Vector2d(x_ + other.x_, y_ + other.y_);
+  }
+  // returns difference of the current and other vector
+  constexpr Vector2d operator-(const Vector2d& other) const
+  {
+    return Vector2d(x_ - other.x_, y_ - other.y_);
+  }
+  // returns the opposite vector
+  constexpr Vector2d operator-() const { return Vector2d(-x_, -y_); }
   // adds other vector2d replacing the current value
-  Vector2d& operator+=(const Vector2d& other);
+  constexpr Vector2d& operator+=(const Vector2d& other)
+  {
+    x_ += other.x_;
+    y_ += other.y_;
+    return *this;
+  }
+  // substracts other vector2d replacing the current value
+  constexpr Vector2d& operator-=(const Vector2d& other)
+  {
+    x_ -= other.x_;
+    y_ -= other.y_;
+    return *this;
+  }
+  // multiplies the current value by scalar
+  constexpr Vector2d& operator*=(float scalar)
+  {
+    x_ *= scalar;
+    y_ *= scalar;
+    return *this;
+  }
+  // checks if both components of the vectors are equal
+  constexpr bool operator==(const Vector2d& other) const
+  {
+    return x_ == other.x_ && y_ == other.y_;
+  }
+  constexpr bool operator!=(const Vector2d& other) const
+  {
+    return !(*this == other);
+  }
 
   private:
   // vector axis components
@@ -38,6 +95,12 @@ class Vector2d
   float y_;
 };
 
+// returns the vector multiplied by scalar
+constexpr Vector2d operator*(float scalar, const Vector2d& A)
+{
+  return A * scalar;
+}
+
 // mathematical constants used
 
 constexpr float c_Pi = M_PI;
@@ -47,17 +110,72 @@ constexpr float c_Pi = M_PI;
 // calculates vertical distance beetween two vectors
 inline float VerticalDistance(const Vector2d& A, const Vector2d& B)
 {
-  return fabs(B.Y() - A.Y());
+  return std::fabs(B.Y() - A.Y());
 }
 
 // calculates horizontal distance beetween two vectors
 inline float HorizontalDistance(const Vector2d& A, const Vector2d& B)
 {
-  return fabs(B.X() - A.X());
+  return std::fabs(B.X() - A.X());
 }
 
 // converts angle in degrees to angle in radians
-inline float ToRadians(float degrees) { return degrees * c_Pi / 180.0f; }
+constexpr float ToRadians(float degrees) { return degrees * c_Pi / 180.0f; }
+
+// converts angle in radians to angle in degrees
+constexpr float ToDegrees(float radians) { return radians * 180.0f / c_Pi; }
+
+// calculates the dot product of two vectors
+constexpr float Dot(const Vector2d& A, const Vector2d& B)
+{
+  return A.X() * B.X() + A.Y() * B.Y();
+}
+
+// calculates the squared length of the vector; spares the square root when
+// only comparing lengths
+constexpr float LengthSquared(const Vector2d& A) { return Dot(A, A); }
+
+// calculates the length of the vector
+inline float Length(const Vector2d& A) { return std::sqrt(LengthSquared(A)); }
+
+// returns the unit vector pointing in the same direction; the zero vector is
+// returned unchanged
+inline Vector2d Normalised(const Vector2d& A)
+{
+  const float length = Length(A);
+  return length > 0.0f ? A / length : A;
+}
+
+// reflects the vector off the surface described by its unit normal
+constexpr Vector2d Reflect(const Vector2d& A, const Vector2d& normal)
+{
+  return A - normal * (2.0f * Dot(A, normal));
+}
+
+// limits each component of the vector to the range given by the
+// corresponding components of the min and max vectors
+constexpr Vector2d Clamp(
+    const Vector2d& A, const Vector2d& min, const Vector2d& max)
+{
+  return Vector2d(
+      std::clamp(A.X(), min.X(), max.X()), std::clamp(A.Y(), min.Y(), max.Y()));
+}
+
+// linearly interpolates between two vectors; t = 0 gives A, t = 1 gives B
+constexpr Vector2d Lerp(const Vector2d& A, const Vector2d& B, float t)
+{
+  return A + (B - A) * t;
+}
+
+// rotates the vector by the angle in radians; positive angles rotate
+// counter-clockwise as displayed on the screen (where the y axis points down)
+inline Vector2d Rotate(const Vector2d& A, float angle)
+{
+  const float cos_angle = std::cos(angle);
+  const float sin_angle = std::sin(angle);
+  return Vector2d(A.X() * cos_angle + A.Y() * sin_angle,
+      A.Y() * cos_angle - A.X() * sin_angle);
+}
 
 } // end of gMath namespace
 #endif // !Vector2d_hpp
@@ -0,0 +1,322 @@
+#include "Arena.hpp"
+#include <stdexcept>
+
+// Constructor. Takes the dimensions of the game area and its objects, the path
+// to the level files, the number of levels implemented, the seed of the random
+// numbers used in the game and the asset pack the level files are read from
+// (NOT OWNED; the files are read from the disk if it's nullptr or doesn't
+// contain them). Loads the first level. Throws std::runtime_error if unable to
+// load level data and std::invalid_argument if the layout doesn't allow to
+// create the game objects
+Arena::Arena(const ArenaLayout& layout, const std::string& levelsPath,
+    unsigned levelsImplemented, std::uint64_t seed, const AssetPack* assets)
+    : layout_(layout)
+    , levels_path_(levelsPath)
+    , assets_(assets)
+    , max_level_(levelsImplemented)
+    // load all the data for the first level
+    , level_data_(std::make_unique<LevelData>(levels_path_, 1, assets_))
+    // the blocks are placed on a lattice starting right after the walls
+    , blocks_(layout_.wall_tickness - 1, layout_.wall_tickness,
+          LevelData::block_width, LevelData::block_height, LevelData::row_size,
+          LevelData::max_rows)
+    , balls_remaining_(level_data_->Lives())
+    , random_(seed)
+{
+  // check if the layout leaves any room for the game
+  if (layout_.width <= 2 * layout_.wall_tickness
+      || layout_.height <= layout_.wall_tickness) {
+    throw std::invalid_argument(
+        "Invalid layout passed to the Arena constructor");
+  }
+
+  CreateWalls();
+  CreateBlocks();
+
+  // calculate and create rectangle limiting the paddle move range
+  gMath::Rect limits;
+  // set top-left coordinates of the limiting rectangle
+  limits.x = layout_.wall_tickness;
+  limits.y = layout_.height * 4 / 5;
+  // set width of the limiting rectangle
+  limits.w = layout_.width - 2 * layout_.wall_tickness;
+  // set height of the limiting rectangle
+  limits.h = layout_.height - limits.y;
+
+  // create the paddle at the bottom of the screen
+  paddle_ = std::make_unique<Paddle>(layout_.width / 2.0f,
+      layout_.height - layout_.paddle_height / 2.0f,
+      level_data_->PaddleSpeed(), limits, layout_.paddle_width / 2.0f,
+      layout_.paddle_height / 2.0f);
+
+  // create the pool of balls starting with a single ball on the paddle
+  Ball ball { level_data_->BallSpeed(), layout_.ball_radius, *paddle_,
+    layout_.height, *this, side_walls_, blocks_ };
+  ball.PlaceOnPaddle();
+  balls_ = std::make_unique<BallPool>(max_balls, ball);
+}
+
+// updates the state of the paddle and the balls by the given time (seconds)
+void Arena::Update(float deltaTime)
+{
+  // the positions before the step, for interpolating the displayed ones
+  paddle_->KeepPreviousPosition();
+  for (auto& ball : *balls_) {
+    ball.KeepPreviousPosition();
+  }
+
+  // upate paddle state
+  paddle_->Update(deltaTime);
+  // update the state of all the balls in a single pass
+  balls_->Update(deltaTime);
+
+  // the player loses a life only when the last ball has left the screen
+  if (balls_->Empty() && !IsLost()) {
+    HandleBallEscape();
+  }
+}
+
+// Loads new level. Returns true if new level loaded successfully,
+// false if the requested level is not implemented
+bool Arena::LoadLevel(unsigned newLevel)
+{
+  // if the current_level was the last one implemented,
+  // false indicates that the game has reached the end
+  if (newLevel > max_level_) {
+    return false;
+  }
+
+  // load all the data for the new level
+  level_data_ = std::make_unique<LevelData>(levels_path_, newLevel, assets_);
+
+  // set player ramaining balls/lives
+  balls_remaining_ = level_data_->Lives();
+
+  // replace blocks of the previous level with new ones
+  CreateBlocks();
+
+  ResetPaddleAndBall();
+
+  // level loaded succesfully
+  return true;
+}
+
+// starts the game from the first level with no points
+void Arena::Restart()
+{
+  // Load level one once again
+  LoadLevel(1);
+
+  total_points_ = 0;
+  // the events of the abandoned game don't count
+  events_.Clear();
+}
+
+// steers the paddle and the balls as the player commands
+void Arena::HandleCommand(PlayerCommand command)
+{
+  switch (command) {
+    case PlayerCommand::MoveUp:
+      // move paddle up only if it has not outrun the balls
+      if (CanPaddleMoveUp()) {
+        paddle_->MoveUp();
+      }
+      break;
+    case PlayerCommand::MoveDown:
+      paddle_->MoveDown();
+      break;
+    case PlayerCommand::MoveLeft:
+      paddle_->MoveLeft();
+      break;
+    case PlayerCommand::MoveRight:
+      paddle_->MoveRight();
+      break;
+    case PlayerCommand::SpinLeft:
+      for (auto& ball : *balls_) {
+        ball.SetSpin(Spin::Left);
+      }
+      break;
+    case PlayerCommand::SpinRight:
+      for (auto& ball : *balls_) {
+        ball.SetSpin(Spin::Right);
+      }
+      break;
+    case PlayerCommand::SpeedUp:
+      for (auto& ball : *balls_) {
+        ball.SetSpeedDelta(speed_increment_);
+      }
+      break;
+    case PlayerCommand::SlowDown:
+      for (auto& ball : *balls_) {
+        ball.SetSpeedDelta(-speed_decrement_);
+      }
+      break;
+    case PlayerCommand::StartBall:
+      // start only the ball which is in the starting position
+      for (auto& ball : *balls_) {
+        if (!ball.IsMoving()) {
+          ball.Start();
+        }
+      }
+      break;
+    case PlayerCommand::None:
+      paddle_->Stop();
+      for (auto& ball : *balls_) {
+        ball.SetSpin(Spin::None);
+        ball.SetSpeedDelta(0.0f);
+      }
+      break;
+  }
+}
+
+// copies everything displayed from the game area into the snapshot
+void Arena::Capture(FrameSnapshot& snapshot) const
+{
+  static_assert(FrameSnapshot::max_balls >= max_balls,
+      "The snapshot must have room for all the balls in play");
+
+  snapshot.previous_paddle = paddle_->PreviousPosition();
+  snapshot.paddle = paddle_->Position();
+  snapshot.ball_count = 0;
+  for (const auto& ball : *balls_) {
+    snapshot.previous_balls[snapshot.ball_count] = ball.PreviousPosition();
+    snapshot.balls[snapshot.ball_count++] = ball.Position();
+  }
+
+  // the lattice of the blocks always fits into the snapshot
+  snapshot.block_count = blocks_.Size();
+  snapshot.block_alive.reset();
+  for (std::size_t i = 0; i < blocks_.Size(); i++) {
+    const gMath::Vector2d position = blocks_.Position(i);
+    snapshot.blocks[i] = FrameSnapshot::Block { position.X(), position.Y(),
+      blocks_.SpriteOf(i) };
+    snapshot.block_alive[i] = !blocks_.IsDestroyed(i);
+  }
+  snapshot.block_generation = blocks_.Generation();
+
+  snapshot.level = Level();
+  snapshot.total_points = total_points_;
+  snapshot.balls_remaining = balls_remaining_;
+}
+
+// handles the last ball leaving the allowed screen area
+void Arena::HandleBallEscape()
+{
+  // decrease number of balls available
+  if (balls_remaining_ > 0) {
+    balls_remaining_--;
+  }
+
+  Post(GameEvent::BallLost);
+
+  // if the player still has lives/balls left, reset the ball passing the level
+  // starting speed to get the ball back on the paddle and cancelling all speed
+  // increases applied by the player
+  if (balls_remaining_ > 0) {
+    balls_->Reset(level_data_->BallSpeed());
+  }
+}
+
+// handles a block (given by its index) being hit by the given ball
+void Arena::HandleBlockHit(std::size_t blockIndex, const Ball& ball)
+{
+  // a silver block splits the ball in two (as long as the pool has room)
+  if (blocks_.SpriteOf(blockIndex) == Sprite::BlockSilver) {
+    balls_->Spawn(ball);
+  }
+
+  // mark block as destroyed to skip further rendering and collision checks
+  blocks_.Destroy(blockIndex);
+
+  // the points are awarded when the event is dispatched
+  Post(GameEvent::BlockDestroyed, blocks_.Points(blockIndex));
+  if (IsLevelCleared()) {
+    Post(GameEvent::LevelCleared);
+  }
+}
+
+// Awards the points for the events recorded since the previous call and passes
+// the records on to the listener. To be called once per frame, after the
+// simulation steps
+void Arena::DispatchEvents()
+{
+  // the listener may cause new events, so the queue is emptied first
+  const EventQueue dispatched = events_;
+  events_.Clear();
+
+  for (const auto& record : dispatched) {
+    // increase points score with point values assigned to the blocks
+    total_points_ += record.points;
+    if (listener_) {
+      listener_->OnEvent(record);
+    }
+  }
+}
+
+// checks if the paddle can move up without outrunning any of the balls
+bool Arena::CanPaddleMoveUp() const
+{
+  // the paddle must not outrun any ball (with some reasonable margin)
+  // helps avoid visual apearance of ball overlaping the paddle
+  // when ball hits the paddle but the paddle is still moving up
+  for (const auto& ball : *balls_) {
+    if (gMath::VerticalDistance(paddle_->Position(), ball.Position())
+        <= paddle_->HalfHeight() + 5 * ball.Radius()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// creates the walls limiting the game area
+void Arena::CreateWalls()
+{
+  const float half_tickness = layout_.wall_tickness / 2.0f;
+  // design predicts 3 walls so reserve enough space
+  side_walls_.reserve(3);
+
+  // top wall spans the whole width of the screen
+  side_walls_.emplace_back(layout_.width / 2.0f, half_tickness,
+      ScreenSide::Top, half_tickness, layout_.width / 2.0f);
+  // left and right walls span the whole height of the screen
+  side_walls_.emplace_back(half_tickness, layout_.height / 2.0f,
+      ScreenSide::Left, half_tickness, layout_.height / 2.0f);
+  side_walls_.emplace_back(layout_.width - half_tickness,
+      layout_.height / 2.0f, ScreenSide::Right, half_tickness,
+      layout_.height / 2.0f);
+}
+
+// creates blocks for the current level
+void Arena::CreateBlocks()
+{
+  // remove blocks of the previous level
+  blocks_.Clear();
+
+  // aquire the sprite table representing block layout
+  auto& sprite_table = level_data_->SpriteTable();
+  // point value assigned to block on current game level
+  const unsigned point_value { level_data_->PointsPerBlock() };
+  // parse each row of the spirte_table
+  for (std::size_t row = 0; row < sprite_table.size(); row++) {
+    // parse each column of the row
+    for (std::size_t col = 0; col < sprite_table[row].size(); col++) {
+      // construct only those blocks, for which there is a sprite set in the
+      // sprite table
+      if (sprite_table[row][col] != Sprite::None) {
+        blocks_.Add(col, row, sprite_table[row][col], point_value);
+      }
+    }
+  }
+}
+
+// puts the paddle and the ball in the starting position for the level
+void Arena::ResetPaddleAndBall()
+{
+  // set paddle position to default and speed to paddle level speed
+  paddle_->SetPosition(
+      layout_.width / 2.0f, layout_.height - paddle_->HalfHeight());
+  paddle_->SetSpeed(level_data_->PaddleSpeed());
+
+  // leave a single ball with the level speed and place it on the paddle
+  balls_->Reset(level_data_->BallSpeed());
+}
@@ -0,0 +1,168 @@
+#include "ArenaView.hpp"
+#include "SDLexception.hpp"
+#include <stdexcept>
+
+// Constructor. Takes the arena to be displayed, the atlas with the sprites used
+// in the game and the renderer used for drawing. Throws std::invalid_argument
+// if any of the sprites displayed in the arena is missing in the atlas and
+// SDLexception if creating the layer fails
+ArenaView::ArenaView(const Arena& arena, const SpriteAtlas& atlas,
+    SDL_Renderer* gameRenderer)
+    : arena_(arena)
+    , sdl_renderer_(gameRenderer)
+    , atlas_(atlas)
+    , layer_(nullptr)
+{
+  // all the sprites which can be displayed in the arena
+  const Sprite arena_sprites[] = { Sprite::Ball, Sprite::Paddle,
+    Sprite::WallHorizontal, Sprite::WallVertical, Sprite::BlockGreen,
+    Sprite::BlockSilver, Sprite::BlockBlue, Sprite::BlockOrange,
+    Sprite::BlockPurple, Sprite::BlockRed, Sprite::BlockTeal,
+    Sprite::BlockYellow };
+
+  for (Sprite sprite : arena_sprites) {
+    if (!atlas.Contains(sprite)) {
+      throw std::invalid_argument(
+          "Missing sprite passed to the ArenaView constructor");
+    }
+  }
+
+  // the layer covers the whole game area; custom deleter is used due to
+  // specific SDL texture destructon function
+  layer_ = std::unique_ptr<SDL_Texture, std::function<void(SDL_Texture*)>> {
+    SDL_CreateTexture(sdl_renderer_, SDL_PIXELFORMAT_RGBA32,
+        SDL_TEXTUREACCESS_TARGET, static_cast<int>(arena_.Layout().width),
+        static_cast<int>(arena_.Layout().height)),
+    [](SDL_Texture* ptr) { SDL_DestroyTexture(ptr); }
+  };
+  if (!layer_) {
+    throw SDLexception("Failed to create the arena layer texture",
+        SDL_GetError(), __FILE__, __LINE__);
+  }
+  // the areas without walls and blocks are transparent
+  SDL_SetTextureBlendMode(layer_.get(), SDL_BLENDMODE_BLEND);
+}
+
+// adds the commands displaying the game area captured in the snapshot to the
+// draw list; the paddle and the balls are displayed at the given part (alpha,
+// 0 to 1) of the way from their previous to their current positions
+void ArenaView::Draw(
+    DrawList& drawList, const FrameSnapshot& snapshot, float alpha) const
+{
+  // display the walls and the blocks
+  UpdateLayer(snapshot);
+  const SDL_Rect whole { 0, 0, static_cast<int>(arena_.Layout().width),
+    static_cast<int>(arena_.Layout().height) };
+  const SDL_FRect whole_screen { 0.0f, 0.0f, arena_.Layout().width,
+    arena_.Layout().height };
+  drawList.Add(DrawLayer::Arena, layer_.get(), whole, whole_screen);
+
+  // display the movable objects on top of the others
+  DrawMovableSprite(drawList, Sprite::Paddle,
+      gMath::Lerp(snapshot.previous_paddle, snapshot.paddle, alpha));
+  for (std::size_t i = 0; i < snapshot.ball_count; i++) {
+    DrawMovableSprite(drawList, Sprite::Ball,
+        gMath::Lerp(snapshot.previous_balls[i], snapshot.balls[i], alpha));
+  }
+}
+
+// brings the layer of walls and blocks up to date with the snapshot
+void ArenaView::UpdateLayer(const FrameSnapshot& snapshot) const
+{
+  // the blocks have been replaced (a new level was loaded)
+  if (!layer_valid_ || layer_generation_ != snapshot.block_generation) {
+    RedrawLayer(snapshot);
+    return;
+  }
+
+  // nothing changed since the previous frame; the usual case
+  if (layer_alive_ == snapshot.block_alive) {
+    return;
+  }
+
+  // make the blocks destroyed since the previous frame transparent
+  SDL_SetRenderTarget(sdl_renderer_, layer_.get());
+  SDL_SetRenderDrawBlendMode(sdl_renderer_, SDL_BLENDMODE_NONE);
+  SDL_SetRenderDrawColor(sdl_renderer_, 0x00, 0x00, 0x00, 0x00);
+  const auto destroyed = layer_alive_ & ~snapshot.block_alive;
+  for (std::size_t i = 0; i < snapshot.block_count; i++) {
+    if (destroyed[i]) {
+      const FrameSnapshot::Block& block = snapshot.blocks[i];
+      const SDL_Rect area = Destination(
+          block.sprite, gMath::Vector2d(block.x, block.y));
+      SDL_RenderFillRect(sdl_renderer_, &area);
+    }
+  }
+  SDL_SetRenderTarget(sdl_renderer_, nullptr);
+  layer_alive_ = snapshot.block_alive;
+}
+
+// draws all the walls and the blocks of the snapshot not yet destroyed into the
+// layer
+void ArenaView::RedrawLayer(const FrameSnapshot& snapshot) const
+{
+  SDL_SetRenderTarget(sdl_renderer_, layer_.get());
+  SDL_SetRenderDrawColor(sdl_renderer_, 0x00, 0x00, 0x00, 0x00);
+  SDL_RenderClear(sdl_renderer_);
+
+  for (const auto& wall : arena_.Walls()) {
+    const Sprite sprite = wall.GetScreenSide() == ScreenSide::Top
+        ? Sprite::WallHorizontal
+        : Sprite::WallVertical;
+    DrawLayerSprite(sprite, wall.Position());
+  }
+
+  for (std::size_t i = 0; i < snapshot.block_count; i++) {
+    if (snapshot.block_alive[i]) {
+      const FrameSnapshot::Block& block = snapshot.blocks[i];
+      DrawLayerSprite(block.sprite, gMath::Vector2d(block.x, block.y));
+    }
+  }
+  layer_commands_.Submit(sdl_renderer_);
+  SDL_SetRenderTarget(sdl_renderer_, nullptr);
+
+  layer_valid_ = true;
+  layer_generation_ = snapshot.block_generation;
+  layer_alive_ = snapshot.block_alive;
+}
+
+// adds the command drawing the sprite centred at the given position into the
+// layer, aligned to whole pixels
+void ArenaView::DrawLayerSprite(
+    Sprite sprite, const gMath::Vector2d& position) const
+{
+  // the erased blocks must cover exactly the same pixels
+  const SDL_Rect area = Destination(sprite, position);
+  const SDL_FRect destination { static_cast<float>(area.x),
+    static_cast<float>(area.y), static_cast<float>(area.w),
+    static_cast<float>(area.h) };
+  layer_commands_.Add(DrawLayer::Arena, atlas_.GetSDLtexture(),
+      atlas_.Region(sprite), destination);
+}
+
+// adds the command displaying the movable sprite centred at the given position
+// to the draw list, at a sub-pixel position
+void ArenaView::DrawMovableSprite(
+    DrawList& drawList, Sprite sprite, const gMath::Vector2d& position) const
+{
+  const SDL_Rect& region = atlas_.Region(sprite);
+  const auto width = static_cast<float>(region.w);
+  const auto height = static_cast<float>(region.h);
+  // not rounded, so a slowly moving object glides instead of stepping by
+  // whole pixels
+  const SDL_FRect destination { position.X() - width / 2.0f,
+    position.Y() - height / 2.0f, width, height };
+  drawList.Add(DrawLayer::Movable, atlas_.GetSDLtexture(), region, destination);
+}
+
+// returns the rectangle covered by the sprite centred at the given position,
+// aligned to whole pixels
+SDL_Rect ArenaView::Destination(
+    Sprite sprite, const gMath::Vector2d& position) const
+{
+  const SDL_Rect& region = atlas_.Region(sprite);
+  // top-left corner rounded to whole pixels, so the static sprites don't
+  // shimmer
+  return SDL_Rect { static_cast<int>(position.X()) - region.w / 2,
+    static_cast<int>(position.Y()) - region.h / 2, region.w, region.h };
+}
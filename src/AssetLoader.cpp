@@ -0,0 +1,85 @@
+#include "AssetLoader.hpp"
+#include "Paths.hpp"
+#include "SDL_image.h"
+#include "SDLexception.hpp"
+#include <fstream>
+#include <limits>
+
+// for operator""s usage
+using std::string_literals::operator""s;
+
+// Constructor. Takes the path of the asset pack. Throws std::runtime_error if
+// the pack exists but can't be mapped or is not valid
+AssetLoader::AssetLoader(const std::string& packPath)
+{
+  // without the pack the assets are read from their files
+  if (std::ifstream { packPath, std::ios::binary }) {
+    pack_ = std::make_unique<AssetPack>(packPath, Paths::pAssets);
+  }
+}
+
+// Returns a new stream reading the asset with the given path; to be closed by
+// the caller (e.g. passed to a loading function closing it). Throws
+// SDLexception if the asset can't be opened
+SDL_RWops* AssetLoader::Open(const std::string& path) const
+{
+  const AssetEntry* entry = pack_ ? pack_->Find(path) : nullptr;
+  SDL_RWops* stream { nullptr };
+  if (entry && entry->kind == AssetKind::File
+      && entry->data.size()
+          <= static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+    // reads the mapped memory; no file is opened and nothing is copied
+    stream = SDL_RWFromConstMem(
+        entry->data.data(), static_cast<int>(entry->data.size()));
+  }
+  else {
+    stream = SDL_RWFromFile(path.c_str(), "rb");
+  }
+  if (!stream) {
+    throw SDLexception { "Unable to open asset: "s + path, SDL_GetError(),
+      __FILE__, __LINE__ };
+  }
+  return stream;
+}
+
+// Returns the image with the given path in the RGBA32 pixel format. An image
+// decoded in advance is not copied: the surface uses the mapped pixels and
+// must only be read. Throws SDLexception if loading or converting the image
+// fails
+AssetLoader::SurfacePtr AssetLoader::LoadImage(const std::string& path) const
+{
+  auto free_surface = [](SDL_Surface* ptr) { SDL_FreeSurface(ptr); };
+
+  const AssetEntry* entry = pack_ ? pack_->Find(path) : nullptr;
+  if (entry && entry->kind == AssetKind::RgbaImage) {
+    // the pack is mapped read-only; the surface never writes its pixels
+    SurfacePtr image { SDL_CreateRGBSurfaceWithFormatFrom(
+                           const_cast<char*>(entry->data.data()),
+                           static_cast<int>(entry->width),
+                           static_cast<int>(entry->height), 32,
+                           static_cast<int>(entry->width * 4),
+                           SDL_PIXELFORMAT_RGBA32),
+      free_surface };
+    if (!image) {
+      throw SDLexception { "Unable to wrap image: "s + path, SDL_GetError(),
+        __FILE__, __LINE__ };
+    }
+    return image;
+  }
+
+  // the stream is closed by the image library
+  SurfacePtr loaded { IMG_Load_RW(Open(path), 1), free_surface };
+  if (!loaded) {
+    throw SDLexception { "Unable to load image: "s + path, IMG_GetError(),
+      __FILE__, __LINE__ };
+  }
+  SurfacePtr converted {
+    SDL_ConvertSurfaceFormat(loaded.get(), SDL_PIXELFORMAT_RGBA32, 0),
+    free_surface
+  };
+  if (!converted) {
+    throw SDLexception { "Unable to convert image: "s + path, SDL_GetError(),
+      __FILE__, __LINE__ };
+  }
+  return converted;
+}
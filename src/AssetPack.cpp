@@ -0,0 +1,186 @@
+#include "AssetPack.hpp"
+#include <stdexcept>
+#include <utility>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// for operator""s usage
+using namespace std::string_literals;
+
+namespace {
+// reads the little-endian number of the given size (bytes) at the position
+std::uint64_t ReadNumber(const char* position, std::size_t bytes)
+{
+  std::uint64_t value { 0 };
+  for (std::size_t i = bytes; i > 0; i--) {
+    value = (value << 8) | static_cast<unsigned char>(position[i - 1]);
+  }
+  return value;
+}
+}
+
+// Constructor. Takes the path of the pack and the path of the assets directory
+// the looked up paths start with. Throws std::runtime_error if the pack can't
+// be opened or mapped or if its contents are not valid
+AssetPack::AssetPack(const std::string& packPath, std::string assetsRoot)
+    : assets_root_(std::move(assetsRoot))
+{
+  Map(packPath);
+  try {
+    ReadIndex(packPath);
+  }
+  catch (...) {
+    // the destructor isn't run for a partially constructed object
+    Unmap();
+    throw;
+  }
+}
+
+// Destructor. Unmaps the pack; the views of the assets become invalid
+AssetPack::~AssetPack()
+{
+  Unmap();
+}
+
+// releases the mapping and the handles of the file, if any
+void AssetPack::Unmap()
+{
+  entries_.clear();
+#ifdef _WIN32
+  if (data_) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_) {
+    CloseHandle(mapping_);
+  }
+  if (file_) {
+    CloseHandle(file_);
+  }
+  mapping_ = nullptr;
+  file_ = nullptr;
+#else
+  if (data_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+// returns the asset with the given path (starting with the assets root or
+// relative to it), or nullptr if the pack doesn't contain it
+const AssetEntry* AssetPack::Find(std::string_view path) const
+{
+  if (path.substr(0, assets_root_.size()) == assets_root_) {
+    path.remove_prefix(assets_root_.size());
+  }
+  const auto found = entries_.find(path);
+  return found != entries_.end() ? &found->second : nullptr;
+}
+
+// maps the whole file into memory; throws std::runtime_error on failure
+void AssetPack::Map(const std::string& packPath)
+{
+#ifdef _WIN32
+  HANDLE file = CreateFileA(packPath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    throw std::runtime_error("Unable to open asset pack: "s + packPath);
+  }
+  file_ = file;
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    Unmap();
+    throw std::runtime_error("Unable to read asset pack: "s + packPath);
+  }
+  size_ = static_cast<std::size_t>(size.QuadPart);
+  mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping_) {
+    data_ = static_cast<const char*>(
+        MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+  }
+  if (!data_) {
+    Unmap();
+    throw std::runtime_error("Unable to map asset pack: "s + packPath);
+  }
+#else
+  const int file = open(packPath.c_str(), O_RDONLY);
+  if (file < 0) {
+    throw std::runtime_error("Unable to open asset pack: "s + packPath);
+  }
+  struct stat status;
+  if (fstat(file, &status) != 0 || status.st_size == 0) {
+    close(file);
+    throw std::runtime_error("Unable to read asset pack: "s + packPath);
+  }
+  size_ = static_cast<std::size_t>(status.st_size);
+  void* mapped = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+  // the mapping stays valid after closing the file
+  close(file);
+  if (mapped == MAP_FAILED) {
+    size_ = 0;
+    throw std::runtime_error("Unable to map asset pack: "s + packPath);
+  }
+  data_ = static_cast<const char*>(mapped);
+#endif
+}
+
+// reads the index of the assets; throws std::runtime_error if it isn't valid
+void AssetPack::ReadIndex(const std::string& packPath)
+{
+  const auto invalid = [&packPath]() {
+    return std::runtime_error("Invalid asset pack: "s + packPath);
+  };
+
+  const std::string_view contents { data_, size_ };
+  if (contents.substr(0, magic.size()) != magic
+      || size_ < magic.size() + 4) {
+    throw invalid();
+  }
+  std::size_t position = magic.size();
+  const auto count = ReadNumber(data_ + position, 4);
+  position += 4;
+  if (count > size_ / index_entry_size) {
+    throw invalid();
+  }
+
+  entries_.reserve(count);
+  for (std::uint64_t i = 0; i < count; i++) {
+    if (size_ - position < index_entry_size) {
+      throw invalid();
+    }
+    const auto name_size = ReadNumber(data_ + position, 4);
+    AssetEntry entry;
+    entry.kind = static_cast<AssetKind>(ReadNumber(data_ + position + 4, 4));
+    entry.width = static_cast<unsigned>(ReadNumber(data_ + position + 8, 4));
+    entry.height = static_cast<unsigned>(ReadNumber(data_ + position + 12, 4));
+    const auto offset = ReadNumber(data_ + position + 16, 8);
+    const auto size = ReadNumber(data_ + position + 24, 8);
+    position += index_entry_size;
+
+    // neither the name nor the data may reach beyond the end of the file
+    if (size_ - position < name_size || offset > size_
+        || size > size_ - offset) {
+      throw invalid();
+    }
+    const std::string_view name = contents.substr(position, name_size);
+    position += name_size;
+    entry.data = contents.substr(offset, size);
+    if (entry.kind != AssetKind::File && entry.kind != AssetKind::RgbaImage) {
+      throw invalid();
+    }
+    if (entry.kind == AssetKind::RgbaImage
+        && std::uint64_t { entry.width } * entry.height * 4 != size) {
+      throw invalid();
+    }
+    entries_.emplace(name, entry);
+  }
+}
@@ -1,40 +1,57 @@
 #include "AudioMixer.hpp"
+#include <future>
 #include <string>
+#include <utility>
+#include <vector>
 
 // for operator""s usage
 using namespace std::string_literals;
 
 // Constructor. Initializes support for replaying audio sound effects.
 // Takes vector of sound enum codes and coresponding strings to path of sounds
-// to be replayed. Will throw SDLexception if initialization of sound mixer
-// support or loading of the sound  effect will fail
+// to be replayed and the loader reading the sounds. Will throw SDLexception if
+// initialization of sound mixer support or loading of the sound  effect will
+// fail
 AudioMixer::AudioMixer(
-    const std::unordered_map<Sound, std::string>& soundsAndPaths)
+    const std::unordered_map<Sound, std::string>& soundsAndPaths,
+    const AssetLoader& assets)
 {
-  // strip every pair of enum code (assigned to sound) and corresponding string
-  // with path to the sound to be replayed
+  // Decode all the sounds at once, each on its own thread, so loading takes as
+  // long as the slowest sound instead of all of them together
+  std::vector<std::pair<Sound, std::future<ChunkPtr>>> decoded;
+  decoded.reserve(soundsAndPaths.size());
   for (auto& sound_path_pair : soundsAndPaths) {
-    auto& sound = sound_path_pair.first;
-    auto& path = sound_path_pair.second;
-    // create unique_ptr to SDL Mix_Chunk with custom deleter assuring proper
-    // releasing of resource on destruction
-    auto chunk_ptr
-        = std::unique_ptr<Mix_Chunk, std::function<void(Mix_Chunk*)>>(
-            Mix_LoadWAV(path.c_str()),
-            [](Mix_Chunk* chunk_ptr) { Mix_FreeChunk(chunk_ptr); });
+    decoded.emplace_back(sound_path_pair.first,
+        std::async(std::launch::async, LoadSound, std::cref(assets),
+            std::cref(sound_path_pair.second)));
+  }
+
+  // store the pointers to created sounds into map, which combines sound enum
+  // codes with a ready to use sounds; the first failure is rethrown after all
+  // the decoding threads finish
+  for (auto& [sound, chunk] : decoded) {
+    sound_effects_[sound] = chunk.get();
+  }
+}
 
-    // check if the a sound was loaded to the Mix_Chunk pointer and report error
-    // if not
-    if (!chunk_ptr) {
-      throw SDLexception(
-          "Unable to load sound: "s + path + " SDL_Mixer error: "s,
-          Mix_GetError(), __FILE__, __LINE__);
-    }
+// Loads the sound with the given path through the loader, converted to the
+// format of the opened mixer. Can run on any thread. Throws SDLexception if
+// loading the sound fails
+AudioMixer::ChunkPtr AudioMixer::LoadSound(
+    const AssetLoader& assets, const std::string& path)
+{
+  // create unique_ptr to SDL Mix_Chunk with custom deleter assuring proper
+  // releasing of resource on destruction; the stream is closed by the mixer
+  ChunkPtr chunk_ptr { Mix_LoadWAV_RW(assets.Open(path), 1),
+    [](Mix_Chunk* chunk_ptr) { Mix_FreeChunk(chunk_ptr); } };
 
-    // store the pointer to created sound into map,
-    // which combines sound enum codes with a ready to use sounds
-    sound_effects_[sound] = std::move(chunk_ptr);
+  // check if the a sound was loaded to the Mix_Chunk pointer and report error
+  // if not
+  if (!chunk_ptr) {
+    throw SDLexception("Unable to load sound: "s + path + " SDL_Mixer error: "s,
+        Mix_GetError(), __FILE__, __LINE__);
   }
+  return chunk_ptr;
 }
 
 // replays the sound effect corresponding to to enum sound code passed
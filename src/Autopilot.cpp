@@ -0,0 +1,91 @@
+#include "Autopilot.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// Constructor. Takes the horizontal distance (pixels) between the paddle and
+// the followed ball which is tolerated without moving the paddle.
+// Throws std::invalid_argument if the tolerance is negative
+Autopilot::Autopilot(float tolerance)
+    : tolerance_(tolerance)
+{
+  if (tolerance_ < 0.0f) {
+    throw std::invalid_argument("Autopilot tolerance must not be negative!");
+  }
+}
+
+// Steers the paddle of the arena; to be called before every update.
+// Returns the time (seconds) the steering stays valid as long as the balls keep
+// their velocities, i.e. until the paddle reaches the followed ball
+float Autopilot::Steer(Arena& arena) const
+{
+  Paddle& paddle = arena.GetPaddle();
+
+  // Find the ball to follow: the lowest one among the balls heading down, or
+  // the lowest ball at all if none of them is heading down
+  const Ball* followed = nullptr;
+  bool followed_falls = false;
+  for (auto& ball : arena.Balls()) {
+    // start the balls waiting on the paddle
+    if (!ball.IsMoving()) {
+      ball.Start();
+    }
+    const bool falls = ball.Velocity().Y() > 0.0f;
+    if (!followed || (falls && !followed_falls)
+        || (falls == followed_falls
+            && ball.Position().Y() > followed->Position().Y())) {
+      followed = &ball;
+      followed_falls = falls;
+    }
+  }
+
+  // nothing to follow
+  if (!followed) {
+    paddle.Stop();
+    return std::numeric_limits<float>::infinity();
+  }
+
+  // The paddle starts moving once the offset gets out of the tolerated range
+  // but stops only once it is under the ball. Stopping at the edge of the
+  // range would start the paddle again as soon as the ball moves on
+  const float offset = followed->Position().X() - paddle.Position().X();
+  const float direction = paddle.Velocity().X();
+  if (offset < -tolerance_ || (direction < 0.0f && offset < 0.0f)) {
+    paddle.MoveLeft();
+  }
+  else if (offset > tolerance_ || (direction > 0.0f && offset > 0.0f)) {
+    paddle.MoveRight();
+  }
+  else {
+    paddle.Stop();
+  }
+
+  const bool moving = paddle.Velocity().X() != 0.0f;
+  return TimeToChange(offset,
+      followed->Velocity().X() - paddle.Velocity().X(), moving);
+}
+
+// returns the time after which the horizontal offset of the followed ball from
+// the paddle, changing with the given rate, leaves the tolerated range (the
+// paddle stopped) or gets to zero (the paddle moving)
+float Autopilot::TimeToChange(
+    float offset, float offsetRate, bool paddleMoving) const
+{
+  if (offsetRate == 0.0f) {
+    return std::numeric_limits<float>::infinity();
+  }
+  const float rate = std::fabs(offsetRate);
+  // the moving paddle stops once it gets under the ball, which never happens
+  // if the ball runs away faster than the paddle
+  if (paddleMoving) {
+    if (offset * offsetRate >= 0.0f) {
+      return std::numeric_limits<float>::infinity();
+    }
+    return std::fabs(offset) / rate;
+  }
+  // the stopped paddle starts moving once the offset gets out of the range
+  const float distance
+      = offsetRate > 0.0f ? tolerance_ - offset : tolerance_ + offset;
+  return std::max(0.0f, distance / rate);
+}
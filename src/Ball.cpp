@@ -1,34 +1,37 @@
 #include "Ball.hpp"
-#include "Game.hpp"
+#include "Arena.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 /* Constructor. Takes:
     speed - ball sclar speed in pixels / second
-    texture - texture used for displaying the ball
+    radius - ball radius in pixels
     paddle - reference to paddle against ball collision will be checked
-    game - reference to the main game object
+    screenBottomY - y coordinate of the bottom of the screen
+    arena - reference to the game area the ball moves in
     sideWalls - reference to sideWalls for collision detection
     blocks - blocks to be shot at; for collision detection
 Throws std::invalid_argument if the arguments sent to the constructor where
 invalid */
-Ball::Ball(float speed, const Texture& texture, Paddle& paddle,
-    float screenBottomY, Game& game, const std::vector<SideWall>& sideWalls,
-    std::vector<Block>& blocks)
+Ball::Ball(float speed, float radius, Paddle& paddle, float screenBottomY,
+    Arena& arena, const std::vector<SideWall>& sideWalls,
+    const BlockField& blocks)
     : MovableObject(0.0f, 0.0f, speed)
-    , direction_(0.0f)
     , velocity_(gMath::Vector2d())
-    , texture_(texture)
-    , radius_(texture.Width() / 2.0)
+    , radius_(radius)
     , min_speed_(speed)
-    , paddle_(paddle)
+    , paddle_(&paddle)
     , screen_bottom_y_(screenBottomY)
-    , game_(game)
-    , side_walls_(sideWalls)
-    , _blocks(blocks)
+    , arena_(&arena)
+    , side_walls_(&sideWalls)
+    , blocks_(&blocks)
 {
   // check if the arguments passed to the constructor where valid and the
   // invariant was correctly established. If not - report error
   if (radius_ <= 0.0f || _speed < 0.0f || min_speed_ < 0.0f
-      || side_walls_.empty() || _blocks.empty() || screen_bottom_y_ <= 0.0f)
+      || side_walls_->empty() || blocks_->Size() == 0
+      || screen_bottom_y_ <= 0.0f)
     throw std::invalid_argument(
         "Invalid argument passed to the ball constructor");
 }
@@ -43,43 +46,91 @@ void Ball::Update(float deltaTime)
   }
   // otherwise perfom routine update cycle
   else {
-    // react to ball-paddle collisioins and apply changes to speed and direction
-    // due to spin (only when the the ball hits the paddle)
-    HandlePaddleCollisions();
-
-    HandleWallCollisions();
-
-    HandleBlockCollisions();
-
-    // update ball positoon
-    position_ += velocity_ * deltaTime;
-
-    // react if the ball has left the screen
-    if (HasLeftScreen()) {
-      game_.HandleBallEscape();
+    // part of the update time which has not been simulated yet
+    float remaining_time = deltaTime;
+
+    // Move the ball from contact to contact, so even a very fast ball or
+    // a long update can't tunnel through obstacles. The contacts are resolved
+    // in the order they happen
+    for (unsigned i = 0; i < max_contacts_per_update && remaining_time > 0.0f;
+         i++) {
+      gMath::Vector2d displacement = velocity_ * remaining_time;
+      Contact contact = FindEarliestContact(displacement);
+
+      // nothing on the way - make the whole move
+      if (contact.obstacle == Obstacle::None) {
+        position_ += displacement;
+        break;
+      }
+      // move the ball to the point of impact and react to the contact
+      position_ += displacement * contact.hit.time;
+      remaining_time -= remaining_time * contact.hit.time;
+      ResolveContact(contact);
     }
   }
 }
 
-// updates ball direction and velocity vector;
-// takes new  direction angle in degrees
-void Ball::UpdateDirectionAndVelocity(float directionAngle)
+// Predicts the time (seconds) the ball can move along a straight line without
+// touching a wall, a block or the paddle. Outside the region the paddle moves
+// in, that is the time until the ball reaches the region. Within the region
+// the moves of the paddle can't be predicted, so it is the time the paddle
+// needs to reach the ball at its top speed, whatever its steering. Returns 0
+// for the ball waiting on the paddle or touching it.
+float Ball::TimeToNextContact() const
 {
-  // update direction angle
-  direction_ = directionAngle;
-
-  // recalculate the ball direction to fit within 0 - 360 limits
-  ControlDirection();
-
-  // update velocity vector
-  velocity_ = gMath::Vector2d(gMath::ToRadians(directionAngle)) * _speed;
+  const gMath::Rect& region = paddle_->MoveLimits();
+  const float speed = gMath::Length(velocity_);
+  if (in_starting_pos_ || speed <= 0.0f) {
+    return 0.0f;
+  }
+
+  // the ball moving for that long crosses the whole game area, so it surely
+  // reaches one of the walls or the paddle region on the way
+  const float horizon
+      = 2.0f * (screen_bottom_y_ + region.x + region.w) / speed;
+  const gMath::Vector2d displacement = velocity_ * horizon;
+
+  Contact contact;
+  FindWallContact(displacement, contact);
+  FindBlockContact(displacement, contact);
+  if (position_.Y() + radius_ < region.y) {
+    FindPaddleRegionContact(displacement, contact);
+    return contact.obstacle == Obstacle::None ? horizon
+                                              : contact.hit.time * horizon;
+  }
+  float time = contact.obstacle == Obstacle::None ? horizon
+                                                  : contact.hit.time * horizon;
+
+  // The distance between the ball and the paddle shrinks at most as fast as
+  // the sum of their speeds. The bound is predicted again when it expires, so
+  // it gets shorter as the ball approaches the paddle and longer as it
+  // leaves
+  const gMath::Vector2d paddle_position = paddle_->Position();
+  const float dx = std::max(
+      std::fabs(position_.X() - paddle_position.X()) - paddle_->HalfWidth(),
+      0.0f);
+  const float dy = std::max(
+      std::fabs(position_.Y() - paddle_position.Y()) - paddle_->HalfHeight(),
+      0.0f);
+  const float gap = std::sqrt(dx * dx + dy * dy) - radius_;
+  if (gap <= 0.0f) {
+    return 0.0f;
+  }
+  time = std::min(time, gap / (speed + paddle_->Speed()));
+
+  // the ball passing the paddle leaves the screen at the bottom
+  if (velocity_.Y() > 0.0f) {
+    time = std::min(
+        time, (screen_bottom_y_ + radius_ - position_.Y()) / velocity_.Y());
+  }
+  return std::max(time, 0.0f);
 }
 
-// render the ball
-void Ball::Draw() const
+// sets the direction of the ball movement keeping the current speed;
+// takes any non-zero vector pointing in the new direction
+void Ball::SetDirection(const gMath::Vector2d& direction)
 {
-  texture_.Render(
-      static_cast<int>(position_.X()), static_cast<int>(position_.Y()));
+  velocity_ = gMath::Normalised(direction) * _speed;
 }
 
 // sets current speed of the object if it is not lower than minimal speed
@@ -88,8 +139,8 @@ void Ball::SetSpeed(float speed)
   if (speed >= min_speed_) {
     // update speed
     _speed = speed;
-    // update velocity vector
-    velocity_ = gMath::Vector2d(gMath::ToRadians(direction_)) * speed;
+    // update length of the velocity vector keeping the direction
+    SetDirection(velocity_);
   }
 }
 
@@ -98,8 +149,8 @@ void Ball::SetSpeed(float speed)
 void Ball::Reset(float speed)
 {
   PlaceOnPaddle();
-
-  direction_ = 0.0f;
+  // the ball is put back on the paddle at once, not moved there
+  KeepPreviousPosition();
 
   velocity_ = gMath::Vector2d { 0.0f };
 
@@ -114,60 +165,46 @@ void Ball::Reset(float speed)
 // starts the ball movement
 void Ball::Start()
 {
-  // calculate randomized starting direction when ball starts from the paddle
-  float starting_direction = randomizer_(45.0f, 135.0f);
-  // update ball state;
-  UpdateDirectionAndVelocity(starting_direction);
+  // calculate randomized starting direction (in degrees) when ball starts
+  // from the paddle
+  float starting_direction = arena_->Random()(45.0f, 135.0f);
+  // update ball velocity vector
+  velocity_
+      = gMath::Vector2d(gMath::ToRadians(starting_direction)) * _speed;
   // mark that the ball doesn't have to start from the paddle
   in_starting_pos_ = false;
-  // play the correct sound
-  game_.PlaySound(Sound::BallPaddleHit);
+  // let the others know the ball has started
+  arena_->Post(GameEvent::BallStarted);
 }
 
 // puts the ball in the starting position on the paddle
 void Ball::PlaceOnPaddle()
 {
   // calculate the correct position
-  float start_x = paddle_.Position().X();
-  float start_y
-      = paddle_.Position().Y() - paddle_.HalfHeight() - texture_.Height() / 2.0;
+  float start_x = paddle_->Position().X();
+  float start_y = paddle_->Position().Y() - paddle_->HalfHeight() - radius_;
 
   // update position vector
   position_ = gMath::Vector2d(start_x, start_y);
 }
 
-// checks if the ball has hit the paddle. If so, updates the game state
-// accoringly:
-// - changes ball direction after bounce - including applying spin
-// - increases or decreases speed if the user gave a command via controller
-void Ball::HandlePaddleCollisions()
-{
-  if (HasHitPaddle()) {
-    // change direction including spin application
-    BouncePaddle();
-    // Apply speed change requested via keyboard
-    ApplySpeedDelta();
-    // play the proper sound
-    game_.PlaySound(Sound::BallPaddleHit);
-  }
-}
-
 // checks for collision with the paddle. Returns true if colided, false if not
 bool Ball::HasHitPaddle() const
 {
-  // we assume that ball can hit the paddle only when heading downwards, so
-  // first we check the ball directions to spare spourious calculations
-  if (direction_ <= 180.0f && direction_ >= 0.0f) {
+  // we assume that ball can hit the paddle only when heading downwards
+  // (the y axis points down), so first we check the ball velocity to spare
+  // spourious calculations
+  if (velocity_.Y() <= 0.0f) {
     return false;
   }
   // vertical condition of collision
   bool vertical_conditon
-      = gMath::VerticalDistance(position_, paddle_.Position())
-      < radius_ + paddle_.HalfHeight();
+      = gMath::VerticalDistance(position_, paddle_->Position())
+      < radius_ + paddle_->HalfHeight();
 
   bool horizontal_condition
-      = gMath::HorizontalDistance(position_, paddle_.Position())
-      < radius_ + paddle_.HalfWidth();
+      = gMath::HorizontalDistance(position_, paddle_->Position())
+      < radius_ + paddle_->HalfWidth();
 
   return vertical_conditon && horizontal_condition;
 }
@@ -178,328 +215,174 @@ bool Ball::HasLeftScreen() const
   return position_.Y() - radius_ > screen_bottom_y_;
 }
 
-// checks if the ball has hit any of the walls. If so, updates the game state
-// accordingly
-void Ball::HandleWallCollisions()
+// finds the earliest contact of the ball with any obstacle when moving
+// by the given displacement
+Ball::Contact Ball::FindEarliestContact(
+    const gMath::Vector2d& displacement) const
 {
-  for (auto& wall : side_walls_) {
-    // for every side wall check if the ball has hit it
-    if (HasHitWall(wall)) {
-      {
-        // change direction
-        BounceWall(wall);
-        // play the proper sound
-        game_.PlaySound(Sound::BallBounceWall);
-        // only one wall can be hit at a certain moment, so no need to change
-        // any more
-        break;
-      }
-    }
-  }
+  Contact contact;
+  FindWallContact(displacement, contact);
+  FindPaddleContact(displacement, contact);
+  FindBlockContact(displacement, contact);
+  return contact;
 }
 
-// checks if the ball has hit any of the blocks. If so, updates the game state
-// accordingly
-void Ball::HandleBlockCollisions()
+// updates the contact if any of the walls is hit earlier
+void Ball::FindWallContact(
+    const gMath::Vector2d& displacement, Contact& contact) const
 {
-  for (auto& block : _blocks) {
-    // checks if the ball has hit any block which hasn't already been
-    // destroyed
-    if (!block.IsDestroyed() && HasHitBlock(block)) {
-      // change the ball direction
-      BounceBlock(block);
-      // call proper game function
-      game_.HandleBlockHit(block);
+  gMath::SweepHit hit;
+  for (auto& wall : *side_walls_) {
+    // the top wall spans horizontally, the side walls span vertically
+    bool horizontal = wall.GetScreenSide() == ScreenSide::Top;
+    float half_width = horizontal ? wall.HalfLength() : wall.HalfTickness();
+    float half_height = horizontal ? wall.HalfTickness() : wall.HalfLength();
+
+    if (gMath::SweepCircleRect(position_, displacement, radius_,
+            wall.Position(), half_width, half_height, hit)) {
+      KeepEarlier(hit, Obstacle::Wall, contact);
     }
   }
 }
 
-// check if the ball has collided with the specific wall
-bool Ball::HasHitWall(const SideWall& wall) const
-{
-  // check what side of screen the wall is placed
-  ScreenSide side = wall.GetScreenSide();
-  //  check if the distance from the wall is greater than collision distance:
-  // horizontal distance for left and right side wall and the vertical distance
-  // for the top wall
-  switch (side) {
-    case ScreenSide::Left:
-      [[fallthrough]];
-    case ScreenSide::Right:
-      return gMath::HorizontalDistance(position_, wall.Position())
-          <= radius_ + wall.HalfTickness();
-    case ScreenSide::Top:
-      return gMath::VerticalDistance(position_, wall.Position())
-          <= radius_ + wall.HalfTickness();
-    default:
-      throw std::invalid_argument(
-          "Invalid screen side passed to Ball::HasHitWall()");
-  }
-}
-
-// updates ball's direction angle and velocity vector depending on the side of
-// the screen the wall is placed
-void Ball::BounceWall(const SideWall& wall)
-{
-  // check what side of screen the wall is placed
-  ScreenSide side = wall.GetScreenSide();
-  // new direction to be calculated
-  float new_direction {};
-
-  switch (side) {
-    case ScreenSide::Left:
-      new_direction = NewDirectionLeftWallBounced();
-      break;
-    case ScreenSide::Right:
-      new_direction = NewDirectionRightWallBounced();
-      break;
-    case ScreenSide::Top:
-      new_direction = NewDirectionTopWallBounced();
-      break;
-    default:
-      throw std::invalid_argument(
-          "Invalid screen side passed to Ball::BounceWall()");
-  }
-  // update ball's direction and velocity vector
-  UpdateDirectionAndVelocity(new_direction);
-}
-
-// calculates the ball new direction after hitting left wall
-float Ball::NewDirectionLeftWallBounced() const
-{
-  // Ball should hit the left wall only when heading left (up or down)
-  float new_direction {};
-
-  // the ball is heading left and upwards
-  if (direction_ > 90.0f && direction_ <= 180.0f) {
-    new_direction = 180.0f - direction_;
-  }
-  // the ball is heading left and downwards
-  else if (direction_ > 180.0f && direction_ < 270.0f) {
-    float deltaAngle = 270.0f - direction_;
-    new_direction = 270.0f + deltaAngle;
-  }
-  // if the direction is different than above simply keeps it unchanged in order
-  // to avoid strange cycles when the ball didn't manage to escape far enough
-  // from the wall before next collision is detected
-  else {
-    new_direction = direction_;
-  }
-
-  return new_direction;
-}
-
-// calculates the ball new direction after hitting right wall
-float Ball::NewDirectionRightWallBounced() const
-{
-  // Ball should hit the right wall only when heading right (up or down)
-  float new_direction {};
-
-  // the ball is heading right and upwards
-  if (direction_ >= 0.0f && direction_ < 90.0f) {
-    new_direction = 180.0f - direction_;
-  }
-  // the ball is heading right and downwards
-  else if (direction_ > 270.0 && direction_ > 0.0f) {
-    float angle = 360.0f - direction_;
-    new_direction = 180.0f + angle;
-  }
-  // if the direction is different than above simply keeps it unchanged in order
-  // to avoid strange cycles when the ball didn't manage to escepe far enough
-  // from the wall before next collision is detected
-  else {
-    new_direction = direction_;
-  }
-
-  return new_direction;
-}
-
-// calculates the ball new direction after hitting top wall
-float Ball::NewDirectionTopWallBounced() const
+// updates the contact if the paddle is hit earlier
+void Ball::FindPaddleContact(
+    const gMath::Vector2d& displacement, Contact& contact) const
 {
-  // Ball should hit the top wall only when heading towards top (left or right)
-  float new_direction {};
-
-  // the ball is heading towards top and to the left
-  if (direction_ < 180.0f && direction_ >= 90.0f) {
-    float angle = 180.0f - direction_;
-    new_direction = 180.0f + angle;
-  }
-  // the ball is heading towards top and to the right
-  else if (direction_ < 90.0f && direction_ > 0.0f) {
-    new_direction = 360.0f - direction_;
-  }
-  // if the direction is different than above simply keeps it unchanged in order
-  // to avoid strange cycles when the ball didn't manage to escepe far enough
-  // from the wall before next collision is detected
-  else {
-    new_direction = direction_;
-  }
-
-  return new_direction;
-}
-
-// change ball direction after hitting paddle
-// should be called only when the ball hits the paddle
-void Ball::BouncePaddle()
-{
-  float new_direction {};
-
-  // In Ball::HasHitPaddle() we already assured that the ball is heading
-  // downwards (left or right) so we use this to change the ball direction
-  // accordingly
-
-  // if the ball heads downwards and towards the left
-  if (direction_ > 180.0f && direction_ < 270.0f) {
-    float bounce_angle = direction_ - 180.0f;
-    new_direction = 180.0f - bounce_angle;
-    // increment the bounce angle introducing (possibly negative) spin
-    new_direction += CalcSpin(bounce_angle);
-  }
-  // if the ball heads downwards and to the right
-  // that is (direction_ >= 270.0f && direction_ < 360.0f)
-  else {
-    new_direction = 360.0f - direction_;
-    // increment the bounce angle introducing (possibly negative) spin
-    // (bounce_angle == new_direction for the ball heading down and right)
-    new_direction += CalcSpin(new_direction);
+  // we assume that ball can hit the paddle only when heading downwards, so
+  // first we check the ball direction to spare spourious calculations
+  if (displacement.Y() <= 0.0f) {
+    return;
   }
-
-  // avoid sending the ball to far to the left
-  if (new_direction >= 175.0f) {
-    new_direction = 175.0f;
+  gMath::SweepHit hit;
+  // the paddle may have moved into the ball since the last update,
+  // which counts as a hit on the top of the paddle
+  if (HasHitPaddle()) {
+    hit.time = 0.0f;
+    hit.border = RectBorder::Top;
+    hit.normal = gMath::Vector2d(0.0f, -1.0f);
+    KeepEarlier(hit, Obstacle::Paddle, contact);
   }
-  // avoid sending the ball to fart to the right
-  if (new_direction <= 5.0f) {
-    new_direction = 5.0f;
+  else if (gMath::SweepCircleRect(position_, displacement, radius_,
+               paddle_->Position(), paddle_->HalfWidth(),
+               paddle_->HalfHeight(), hit)) {
+    KeepEarlier(hit, Obstacle::Paddle, contact);
   }
-
-  // update ball direction and vellocity
-  UpdateDirectionAndVelocity(new_direction);
-}
-
-// checks if the ball hit a specific block
-bool Ball::HasHitBlock(const Block& block) const
-{
-  // we assume that collision occurs when both the vertical and horizontal
-  // distance from ball to block centre are smaller that the sum of ball
-  // radius and half block hight or width accordingly
-  return (gMath::HorizontalDistance(position_, block.Position())
-             < radius_ + block.HalfWidth())
-      && gMath::VerticalDistance(position_, block.Position())
-      < radius_ + block.HalfHeight();
 }
 
-// determines which block border was hit during collision
-void Ball::BounceBlock(const Block& block)
+// updates the contact if any of the blocks is hit earlier
+void Ball::FindBlockContact(
+    const gMath::Vector2d& displacement, Contact& contact) const
 {
-  // we use left and right coordinate of the block borders in relation to the
-  // ball's position X coordinate to approximate the side of the block being
-  // collided
-  float left_x = block.Position().X() - block.HalfWidth();
-  float right_x = block.Position().X() + block.HalfWidth();
-
-  float new_direction {};
-
-  // for the ball heading upwards and to the right
-  if (direction_ >= 0.0f && direction_ <= 90.0f) {
-    new_direction = BounceBlockGoingUpRight(left_x);
-  }
-  // for the ball  heading upwards and to the left
-  else if (direction_ > 90.0f && direction_ <= 180.0f) {
-    new_direction = BounceBlockGoingUpLeft(right_x);
-  }
-  // for the ball heading downwards and to the left
-  else if (direction_ > 180.0f && direction_ <= 270.0f) {
-    new_direction = BounceBlockGoingDownLeft(right_x);
-  }
-  // for the ball heading downwards and to the right,
-  else {
-    new_direction = BounceBlockGoingDownRight(left_x);
-  }
-  // update ball direction and vellocity
-  UpdateDirectionAndVelocity(new_direction);
+  // area swept by the ball during the move
+  const float end_x = position_.X() + displacement.X();
+  const float end_y = position_.Y() + displacement.Y();
+  const float min_x = std::min(position_.X(), end_x) - radius_;
+  const float max_x = std::max(position_.X(), end_x) + radius_;
+  const float min_y = std::min(position_.Y(), end_y) - radius_;
+  const float max_y = std::max(position_.Y(), end_y) + radius_;
+
+  // only the blocks (not destroyed yet) within the swept area can be hit
+  gMath::SweepHit hit;
+  blocks_->ForEachInArea(
+      min_x, min_y, max_x, max_y, [&](std::size_t blockIndex) {
+        if (gMath::SweepCircleRect(position_, displacement, radius_,
+                blocks_->Position(blockIndex), blocks_->HalfWidth(blockIndex),
+                blocks_->HalfHeight(blockIndex), hit)) {
+          // remember which block has been hit if it is the earliest contact
+          if (KeepEarlier(hit, Obstacle::Block, contact)) {
+            contact.block_index = blockIndex;
+          }
+        }
+      });
 }
 
-// returns new direction after block bounce when going up and right
-float Ball::BounceBlockGoingUpRight(float leftX) const
+// updates the contact if the region the paddle moves in is reached earlier
+void Ball::FindPaddleRegionContact(
+    const gMath::Vector2d& displacement, Contact& contact) const
 {
-  // If the ball is heading upwards and to the right,
-  // either left or bottom  border of the block could be hit
-  float new_direction {};
+  const gMath::Rect& region = paddle_->MoveLimits();
+  const float half_width = region.w / 2.0f;
+  const float half_height = region.h / 2.0f;
 
-  // left border bounce
-  if (position_.X() <= leftX) {
-    new_direction = 180.0f - direction_;
+  gMath::SweepHit hit;
+  if (gMath::SweepCircleRect(position_, displacement, radius_,
+          gMath::Vector2d(region.x + half_width, region.y + half_height),
+          half_width, half_height, hit)) {
+    KeepEarlier(hit, Obstacle::Paddle, contact);
   }
-  // otherwise it is a bottom border bounce
-  else {
-    new_direction = 360.0f - direction_;
-  }
-
-  return new_direction;
 }
 
-// returns new direction after block bounce when going up and left
-float Ball::BounceBlockGoingUpLeft(float rightX) const
+// updates the contact if the hit is earlier than the one already found;
+// returns true if the contact was updated
+bool Ball::KeepEarlier(
+    const gMath::SweepHit& hit, Obstacle obstacle, Contact& contact) const
 {
-  // if the ball is heading upwards and to the left
-  // either right or bottom border of the block could be hit
-
-  // left border bounce
-  if (position_.X() >= rightX) {
-    return 180.0f - direction_;
-  }
-  // bottom border bounce
-  else {
-    return 360.0f - direction_;
+  if (contact.obstacle == Obstacle::None || hit.time < contact.hit.time) {
+    contact.obstacle = obstacle;
+    contact.hit = hit;
+    return true;
   }
+  return false;
 }
 
-// returns new direction after block bounce when going down and left
-float Ball::BounceBlockGoingDownLeft(float rightX) const
+// reacts to the contact with an obstacle: bounces the ball and updates the
+// game state accordingly
+void Ball::ResolveContact(const Contact& contact)
 {
-  // if the ball is heading downwards and to the left,
-  // either right or top border of the block could be hit
-
-  // right border bounce
-  if (position_.X() >= rightX) {
-    float angle = direction_ - 180.0f;
-    return 360.0f - angle;
-  }
-  // top border bounce
-  else {
-    return 360.0f - direction_;
+  switch (contact.obstacle) {
+    case Obstacle::Wall:
+      // change direction
+      Bounce(contact.hit.normal);
+      arena_->Post(GameEvent::WallBounce);
+      break;
+    case Obstacle::Paddle:
+      // change direction including spin application
+      BouncePaddle();
+      // Apply speed change requested via keyboard
+      ApplySpeedDelta();
+      arena_->Post(GameEvent::PaddleHit);
+      break;
+    case Obstacle::Block:
+      // change the ball direction
+      Bounce(contact.hit.normal);
+      // call proper arena function
+      arena_->HandleBlockHit(contact.block_index, *this);
+      break;
+    default:
+      break;
   }
 }
 
-// returns new direction after block bounce when going down and right
-float Ball::BounceBlockGoingDownRight(float leftX) const
+// reflects the velocity off the surface described by its unit normal;
+// doesn't affect the ball moving away from the surface
+void Ball::Bounce(const gMath::Vector2d& normal)
 {
-  // if the ball is heading downwards and to the right,
-  // either left or top border of the block could be hit
-
-  // left border bounce
-  if (position_.X() <= leftX) {
-    float angle = 360.0f - direction_;
-    return 180 + angle;
-  }
-  // top border bounce
-  else {
-    return 360 - direction_;
+  if (gMath::Dot(velocity_, normal) < 0.0f) {
+    velocity_ = gMath::Reflect(velocity_, normal);
   }
 }
 
-// keeps the ball direction angle in range [0,360)
-void Ball::ControlDirection()
+// change ball direction after hitting paddle
+// should be called only when the ball hits the paddle
+void Ball::BouncePaddle()
 {
-  // for angles exceeding the full 360.0 radius
-  if (direction_ >= 360.0f) {
-    direction_ -= 360.0f;
-  }
-  // for possible (but unlikely) negative angles
-  if (direction_ < 0.0f) {
-    direction_ = 360.0f - fabs(direction_);
+  // the ball always bounces upwards (the y axis points down), whatever part
+  // of the paddle it hits
+  velocity_.SetY(-std::fabs(velocity_.Y()));
+
+  // angle (degrees) between the ball path and the paddle surface
+  const float bounce_angle = gMath::ToDegrees(
+      std::atan2(std::fabs(velocity_.Y()), std::fabs(velocity_.X())));
+  // apply (possibly negative) spin by rotating the velocity vector
+  velocity_
+      = gMath::Rotate(velocity_, gMath::ToRadians(CalcSpin(bounce_angle)));
+
+  // avoid sending the ball too flat to the left or to the right
+  if (-velocity_.Y() < _speed * min_paddle_angle_sin) {
+    velocity_ = gMath::Vector2d(
+        std::copysign(_speed * min_paddle_angle_cos, velocity_.X()),
+        -_speed * min_paddle_angle_sin);
   }
 }
 
@@ -519,17 +402,17 @@ float Ball::CalcSpin(float bounceAngle) const
   // angles in range (25,45] degrees
   if (bounceAngle > 25.0f) {
     // spin in range of 20-60 % of original bounce angle
-    delta = randomizer_(0.2f, 0.6f) * bounceAngle;
+    delta = arena_->Random()(0.2f, 0.6f) * bounceAngle;
   }
   // angles in range (10,25] degrees
   else if (bounceAngle > 10.0f) {
     // spin in range of 40-80 % of original bounce angle
-    delta = randomizer_(0.4f, 0.8f) * bounceAngle;
+    delta = arena_->Random()(0.4f, 0.8f) * bounceAngle;
   }
   // angles in range [0,10] degrees
   else {
     // spin range [5.0,10] degrees
-    delta = randomizer_(5.0f, 10.0f);
+    delta = arena_->Random()(5.0f, 10.0f);
   }
 
   // depending of the requested spin return negative or positive spin increase
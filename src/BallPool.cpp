@@ -0,0 +1,113 @@
+#include "BallPool.hpp"
+#include <cmath>
+#include <stdexcept>
+
+// Constructor. Takes the maximum number of balls in play and the ball serving
+// as a prototype for the ball put on the paddle after Reset().
+// The pool starts with a single ball on the paddle.
+// Throws std::invalid_argument if the capacity is 0
+BallPool::BallPool(std::size_t capacity, const Ball& prototype)
+    : capacity_(capacity)
+    , prototype_(prototype)
+    , scheduler_(capacity)
+{
+  if (capacity_ == 0) {
+    throw std::invalid_argument("BallPool capacity must be greater than 0!");
+  }
+  // the only allocation made by the pool
+  balls_.reserve(capacity_);
+  balls_.push_back(prototype_);
+  scheduler_.Schedule(0, clock_);
+}
+
+// updates all the balls by the given time difference and removes the ones
+// which have left the screen; returns the number of balls removed
+std::size_t BallPool::Update(float deltaTime)
+{
+  const double end_time = clock_ + deltaTime;
+  // balls spawned during the pass (appended at the end) start moving in
+  // the next update
+  const std::size_t count = balls_.size();
+  for (std::size_t i = 0; i < count; i++) {
+    // nothing can be touched within the update
+    if (scheduler_.IsFreeUntil(i, end_time)) {
+      balls_[i].Drift(deltaTime);
+    }
+    // perform all the collision tests and predict the next contact again
+    else {
+      balls_[i].Update(deltaTime);
+      scheduler_.Schedule(i, end_time + balls_[i].TimeToNextContact());
+    }
+  }
+  clock_ = end_time;
+
+  // remove the balls which have left the screen; the order of the balls
+  // doesn't matter, so the last ball takes the place of the removed one
+  std::size_t removed { 0 };
+  std::size_t i { 0 };
+  while (i < balls_.size()) {
+    if (balls_[i].HasLeftScreen()) {
+      balls_[i] = balls_.back();
+      balls_.pop_back();
+      // the moved ball gets its contact predicted in the next update
+      scheduler_.Schedule(i, clock_);
+      scheduler_.Cancel(balls_.size());
+      removed++;
+    }
+    else {
+      i++;
+    }
+  }
+  return removed;
+}
+
+// Adds a ball split off the given one: starting from the same position, but
+// heading in the mirrored direction. Returns false if the pool is full
+bool BallPool::Spawn(const Ball& source)
+{
+  // the storage must never grow, as the source may be one of the balls
+  if (balls_.size() >= capacity_) {
+    return false;
+  }
+  balls_.push_back(source);
+
+  // mirror the direction around the vertical axis; a ball heading almost
+  // vertically (less than 10 degrees off) would overlap the source, so it gets
+  // deflected by 30 degrees instead
+  const gMath::Vector2d velocity = source.Velocity();
+  gMath::Vector2d direction { -velocity.X(), velocity.Y() };
+  if (std::fabs(velocity.X()) < 0.17f * gMath::Length(velocity)) {
+    direction = gMath::Rotate(velocity, gMath::ToRadians(30.0f));
+  }
+  balls_.back().SetDirection(direction);
+  // the new ball gets its contact predicted in the next update
+  scheduler_.Schedule(balls_.size() - 1, clock_);
+  return true;
+}
+
+// Returns the time (seconds) until the earliest predicted contact of any ball.
+// Updates not longer than that move all the balls along straight lines, so
+// they may be as long as the time in the simulations where nothing else
+// changes in the meantime.
+float BallPool::TimeToNextEvent()
+{
+  // A destroyed block never makes a contact happen earlier, so the contacts
+  // predicted before remain safe (if pessimistic) and are not recalculated
+  // until they happen
+  if (balls_.empty()) {
+    return 0.0f;
+  }
+  const double next_time = scheduler_.NextEventTime();
+  return next_time > clock_ ? static_cast<float>(next_time - clock_) : 0.0f;
+}
+
+// leaves a single ball with the given speed in the starting position on the
+// paddle
+void BallPool::Reset(float speed)
+{
+  balls_.clear();
+  balls_.push_back(prototype_);
+  balls_.back().Reset(speed);
+  scheduler_.CancelAll();
+  scheduler_.Schedule(0, clock_);
+}
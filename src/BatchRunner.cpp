@@ -0,0 +1,133 @@
+#include "BatchRunner.hpp"
+#include "Autopilot.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+// Constructor. Takes the settings of the batch.
+// Throws std::invalid_argument if the settings are invalid
+BatchRunner::BatchRunner(const BatchSettings& settings)
+    : settings_(settings)
+{
+  if (settings_.level == 0 || settings_.level > settings_.levels_implemented
+      || settings_.time_step <= 0.0f || settings_.time_limit <= 0.0f) {
+    throw std::invalid_argument(
+        "Invalid settings passed to the BatchRunner constructor");
+  }
+}
+
+// plays all the games of the batch and returns their results in the order of
+// the seeds; exceptions thrown by the games are passed on
+std::vector<GameResult> BatchRunner::Run() const
+{
+  // every game writes only its own slot of the results
+  std::vector<GameResult> results(settings_.games);
+
+  unsigned threads = settings_.threads;
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  threads = std::min(threads, std::max(1u, settings_.games));
+
+  // index of the next game to be played
+  std::atomic<unsigned> next_game { 0 };
+  // the first exception thrown by any of the games
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  // each worker takes the games one by one until all have been taken
+  auto worker = [&]() {
+    try {
+      for (unsigned game = next_game++; game < settings_.games;
+           game = next_game++) {
+        results[game] = PlayGame(settings_.seed + game);
+      }
+    }
+    catch (...) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+      // stop the other workers as soon as they finish their current game
+      next_game = settings_.games;
+    }
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads);
+  for (unsigned i = 0; i < threads; i++) {
+    pool.emplace_back(worker);
+  }
+  for (auto& thread : pool) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return results;
+}
+
+// plays a single game with the given seed and returns its result
+GameResult BatchRunner::PlayGame(std::uint32_t seed) const
+{
+  // the game owns its stream of random numbers, so the seed alone makes the
+  // game reproducible
+  Arena arena { ArenaLayout {}, settings_.levels_path,
+    settings_.levels_implemented, seed, settings_.assets };
+  arena.LoadLevel(settings_.level);
+  EventCounter counter;
+  arena.SetListener(&counter);
+  const Autopilot autopilot;
+
+  GameResult result;
+  result.seed = seed;
+  // simulated time; summed up in double precision to avoid accumulating
+  // rounding errors in long games
+  double time { 0.0 };
+  while (time < settings_.time_limit && !arena.IsLevelCleared()
+      && !arena.IsLost()) {
+    const float steering_time = autopilot.Steer(arena);
+    float step = settings_.time_step;
+    // nothing but the balls moving along straight lines happens until the
+    // next event, so a single update can take all the time till then
+    if (settings_.event_jumping) {
+      const auto remaining_time
+          = static_cast<float>(settings_.time_limit - time);
+      step = std::max(step,
+          std::min({ arena.TimeToNextEvent(), steering_time, remaining_time }));
+    }
+    arena.Update(step);
+    arena.DispatchEvents();
+    time += step;
+  }
+
+  result.cleared = arena.IsLevelCleared();
+  result.score = arena.TotalPoints();
+  result.time = static_cast<float>(time);
+  result.balls_lost = counter.balls_lost;
+  result.bounces = counter.bounces;
+  return result;
+}
+
+// updates the counters
+void BatchRunner::EventCounter::OnEvent(const EventRecord& event)
+{
+  switch (event.type) {
+    case GameEvent::WallBounce:
+      [[fallthrough]];
+    case GameEvent::PaddleHit:
+      [[fallthrough]];
+    case GameEvent::BlockDestroyed:
+      bounces += event.count;
+      break;
+    case GameEvent::BallLost:
+      balls_lost += event.count;
+      break;
+    default:
+      break;
+  }
+}
@@ -0,0 +1,84 @@
+#include "BlockField.hpp"
+#include <stdexcept>
+
+// Constructor. Takes the position of the top-left corner of the lattice,
+// the size of a single block and the number of columns and rows.
+// Throws std::invalid_argument if the lattice dimensions are not positive
+BlockField::BlockField(float originX, float originY, float blockWidth,
+    float blockHeight, std::size_t columns, std::size_t rows)
+    : origin_x_(originX)
+    , origin_y_(originY)
+    , block_width_(blockWidth)
+    , block_height_(blockHeight)
+    , grid_(originX, originY, blockWidth, blockHeight, columns, rows)
+{
+  // reserve space for the lattice completely filled with blocks, so adding
+  // blocks never reallocates the arrays
+  const std::size_t capacity = columns * rows;
+  x_.reserve(capacity);
+  y_.reserve(capacity);
+  half_width_.reserve(capacity);
+  half_height_.reserve(capacity);
+  sprites_.reserve(capacity);
+  points_.reserve(capacity);
+  destroyed_.reserve(capacity / bits_per_word + 1);
+}
+
+// removes all the blocks
+void BlockField::Clear()
+{
+  x_.clear();
+  y_.clear();
+  half_width_.clear();
+  half_height_.clear();
+  sprites_.clear();
+  points_.clear();
+  destroyed_.clear();
+  live_count_ = 0;
+  grid_.Clear();
+  generation_++;
+}
+
+// Adds a block into the lattice cell described by column and row. Takes the
+// sprite used for displaying the block and the number of points the player
+// will be awarded after the block is destroyed. Returns index of the block.
+// Throws std::invalid_argument if the point value is not positive and
+// std::out_of_range if the cell lies outside the lattice
+std::size_t BlockField::Add(
+    std::size_t column, std::size_t row, Sprite sprite, unsigned pointValue)
+{
+  if (pointValue == 0) {
+    throw std::invalid_argument(
+        "Invalid point value passed to the BlockField::Add()");
+  }
+  const std::size_t index = Size();
+  // register the block in the spatial index first, as it validates the cell
+  grid_.Insert(column, row, index);
+
+  // the block is centred in its lattice cell
+  x_.push_back(origin_x_ + block_width_ * column + block_width_ / 2.0f);
+  y_.push_back(origin_y_ + block_height_ * row + block_height_ / 2.0f);
+  half_width_.push_back(block_width_ / 2.0f);
+  half_height_.push_back(block_height_ / 2.0f);
+  sprites_.push_back(sprite);
+  points_.push_back(pointValue);
+  // start a new word of the bitset when needed
+  if (index % bits_per_word == 0) {
+    destroyed_.push_back(0u);
+  }
+  live_count_++;
+
+  return index;
+}
+
+// marks the block as destroyed and removes it from the spatial index
+void BlockField::Destroy(std::size_t index)
+{
+  if (IsDestroyed(index)) {
+    return;
+  }
+  destroyed_[index / bits_per_word] |= std::uint64_t { 1 }
+      << (index % bits_per_word);
+  live_count_--;
+  grid_.Remove(Position(index));
+}
@@ -0,0 +1,57 @@
+#include "BlockGrid.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+// Constructor. Takes the position of the top-left corner of the grid,
+// the size of a single cell and the number of columns and rows.
+// Throws std::invalid_argument if the grid dimensions are not positive
+BlockGrid::BlockGrid(float originX, float originY, float cellWidth,
+    float cellHeight, std::size_t columns, std::size_t rows)
+    : origin_x_(originX)
+    , origin_y_(originY)
+    , cell_width_(cellWidth)
+    , cell_height_(cellHeight)
+    , columns_(columns)
+    , rows_(rows)
+    , width_(cellWidth * columns)
+    , height_(cellHeight * rows)
+    , cells_(columns * rows, empty_cell)
+{
+  // make sure that the invariant is correctly established and report error if
+  // not
+  if (cell_width_ <= 0.0f || cell_height_ <= 0.0f || columns_ == 0
+      || rows_ == 0) {
+    throw std::invalid_argument(
+        "Invalid argument passed to the BlockGrid constructor");
+  }
+}
+
+// removes all the blocks from the grid
+void BlockGrid::Clear() { std::fill(cells_.begin(), cells_.end(), empty_cell); }
+
+// Puts the block index into the cell described by column and row.
+// Throws std::out_of_range if the cell lies outside the grid
+void BlockGrid::Insert(
+    std::size_t column, std::size_t row, std::size_t blockIndex)
+{
+  if (column >= columns_ || row >= rows_) {
+    throw std::out_of_range("Block placed outside of the BlockGrid");
+  }
+  cells_[row * columns_ + column] = blockIndex;
+}
+
+// removes the block from the cell containing the given point (for example
+// the block centre); does nothing if the point lies outside the grid
+void BlockGrid::Remove(const gMath::Vector2d& point)
+{
+  // position of the point relative to the grid origin
+  const float x = point.X() - origin_x_;
+  const float y = point.Y() - origin_y_;
+  if (x < 0.0f || y < 0.0f || x >= width_ || y >= height_) {
+    return;
+  }
+  // the cell is found directly from the position, so no search is needed
+  const std::size_t column = static_cast<std::size_t>(x / cell_width_);
+  const std::size_t row = static_cast<std::size_t>(y / cell_height_);
+  cells_[row * columns_ + column] = empty_cell;
+}
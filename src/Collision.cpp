@@ -0,0 +1,164 @@
+#include "Collision.hpp"
+#include <algorithm>
+
+// namespace for grouping objects and functions required for the game
+// calculations
+namespace gMath {
+
+// helper for SweepCircleRect(); reports a hit on the rectangle border, which
+// the overlapping circle penetrates the least. Returns false if the
+// displacement leads the circle out of the rectangle
+static bool OverlapHit(const Vector2d& start, const Vector2d& displacement,
+    float radius, const Vector2d& rectCentre, float halfWidth,
+    float halfHeight, SweepHit& hit)
+{
+  // penetration depth through each of the rectangle borders
+  const float left = start.X() + radius - (rectCentre.X() - halfWidth);
+  const float right = rectCentre.X() + halfWidth - (start.X() - radius);
+  const float top = start.Y() + radius - (rectCentre.Y() - halfHeight);
+  const float bottom = rectCentre.Y() + halfHeight - (start.Y() - radius);
+
+  // choose the border with the smallest penetration
+  float least = left;
+  hit.border = RectBorder::Left;
+  hit.normal = Vector2d(-1.0f, 0.0f);
+  if (right < least) {
+    least = right;
+    hit.border = RectBorder::Right;
+    hit.normal = Vector2d(1.0f, 0.0f);
+  }
+  if (top < least) {
+    least = top;
+    hit.border = RectBorder::Top;
+    hit.normal = Vector2d(0.0f, -1.0f);
+  }
+  if (bottom < least) {
+    hit.border = RectBorder::Bottom;
+    hit.normal = Vector2d(0.0f, 1.0f);
+  }
+  hit.time = 0.0f;
+
+  // the contact matters only if the circle is heading into the rectangle
+  return Dot(displacement, hit.normal) < 0.0f;
+}
+
+// Sweeps a circle (start position and radius) along the displacement vector
+// against an axis-aligned rectangle (centre and half extents) and finds the
+// earliest time of impact.
+// Returns true and fills the hit if the contact occurs within the
+// displacement, false otherwise
+bool SweepCircleRect(const Vector2d& start, const Vector2d& displacement,
+    float radius, const Vector2d& rectCentre, float halfWidth,
+    float halfHeight, SweepHit& hit)
+{
+  // rectangle borders
+  const float min_x = rectCentre.X() - halfWidth;
+  const float max_x = rectCentre.X() + halfWidth;
+  const float min_y = rectCentre.Y() - halfHeight;
+  const float max_y = rectCentre.Y() + halfHeight;
+
+  // check if the circle already overlaps the rectangle
+  const Vector2d gap = start
+      - Clamp(start, Vector2d(min_x, min_y), Vector2d(max_x, max_y));
+  if (LengthSquared(gap) < radius * radius) {
+    return OverlapHit(start, displacement, radius, rectCentre, halfWidth,
+        halfHeight, hit);
+  }
+
+  // The centre of the circle touches the rectangle expanded by the radius
+  // (with rounded corners) exactly when the circle touches the rectangle.
+  // First the ray of the centre is clipped against the expanded rectangle
+  // (slab method), the rounded corners are handled afterwards
+  const float start_pos[2] = { start.X(), start.Y() };
+  const float delta[2] = { displacement.X(), displacement.Y() };
+  const float slab_min[2] = { min_x - radius, min_y - radius };
+  const float slab_max[2] = { max_x + radius, max_y + radius };
+
+  float t_enter = 0.0f;
+  float t_exit = 1.0f;
+  // axis through which the ray enters the expanded rectangle (-1 if the
+  // start point lies already inside it)
+  int enter_axis = -1;
+
+  for (int axis = 0; axis < 2; axis++) {
+    // ray parallel to the slab misses it unless it starts inside
+    if (delta[axis] == 0.0f) {
+      if (start_pos[axis] < slab_min[axis]
+          || start_pos[axis] > slab_max[axis]) {
+        return false;
+      }
+      continue;
+    }
+    float t_near = (slab_min[axis] - start_pos[axis]) / delta[axis];
+    float t_far = (slab_max[axis] - start_pos[axis]) / delta[axis];
+    if (t_near > t_far) {
+      std::swap(t_near, t_far);
+    }
+    // a circle touching the border at the start enters it at time 0
+    if (t_near >= t_enter) {
+      t_enter = t_near;
+      enter_axis = axis;
+    }
+    t_exit = std::min(t_exit, t_far);
+    if (t_enter > t_exit) {
+      return false;
+    }
+  }
+
+  // point of entry into the expanded rectangle
+  const float entry_x = start.X() + displacement.X() * t_enter;
+  const float entry_y = start.Y() + displacement.Y() * t_enter;
+
+  // entering through a flat part of the expanded rectangle means hitting
+  // a border of the rectangle
+  if (enter_axis >= 0
+      && ((entry_x >= min_x && entry_x <= max_x)
+          || (entry_y >= min_y && entry_y <= max_y))) {
+    hit.time = t_enter;
+    if (enter_axis == 0) {
+      hit.border = delta[0] > 0.0f ? RectBorder::Left : RectBorder::Right;
+      hit.normal = Vector2d(delta[0] > 0.0f ? -1.0f : 1.0f, 0.0f);
+    }
+    else {
+      hit.border = delta[1] > 0.0f ? RectBorder::Top : RectBorder::Bottom;
+      hit.normal = Vector2d(0.0f, delta[1] > 0.0f ? -1.0f : 1.0f);
+    }
+    return true;
+  }
+
+  // otherwise the ray enters a corner region, where the expanded rectangle is
+  // rounded: intersect the ray with the circle around the nearest corner
+  const float corner_x = entry_x < rectCentre.X() ? min_x : max_x;
+  const float corner_y = entry_y < rectCentre.Y() ? min_y : max_y;
+  const float m_x = start.X() - corner_x;
+  const float m_y = start.Y() - corner_y;
+  const float a = delta[0] * delta[0] + delta[1] * delta[1];
+  const float b = m_x * delta[0] + m_y * delta[1];
+  const float c = m_x * m_x + m_y * m_y - radius * radius;
+  const float discriminant = b * b - a * c;
+
+  // the ray misses the corner or leads away from it
+  if (a == 0.0f || b >= 0.0f || discriminant < 0.0f) {
+    return false;
+  }
+  const float t_corner = (-b - std::sqrt(discriminant)) / a;
+  if (t_corner < 0.0f || t_corner > 1.0f) {
+    return false;
+  }
+
+  // normal points from the corner towards the circle centre at contact
+  const float normal_x = (m_x + delta[0] * t_corner) / radius;
+  const float normal_y = (m_y + delta[1] * t_corner) / radius;
+  hit.time = t_corner;
+  hit.normal = Vector2d(normal_x, normal_y);
+  // the dominant axis of the normal decides which border was hit
+  if (std::fabs(normal_x) > std::fabs(normal_y)) {
+    hit.border = normal_x < 0.0f ? RectBorder::Left : RectBorder::Right;
+  }
+  else {
+    hit.border = normal_y < 0.0f ? RectBorder::Top : RectBorder::Bottom;
+  }
+  return true;
+}
+
+} // end of gMath namespace
@@ -0,0 +1,71 @@
+#include "CollisionScheduler.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+// Constructor. Takes the number of slots (balls) to be scheduled.
+// Throws std::invalid_argument if the number of slots is 0
+CollisionScheduler::CollisionScheduler(std::size_t slots)
+    : versions_(slots, 0)
+    , times_(slots, -std::numeric_limits<double>::infinity())
+{
+  if (slots == 0) {
+    throw std::invalid_argument(
+        "CollisionScheduler needs at least one slot!");
+  }
+  // room for every slot rescheduled a few times before compacting
+  queue_.reserve(4 * slots);
+}
+
+// schedules the next contact of the ball in the slot at the given time
+// (seconds of the simulation clock), replacing the previous one
+void CollisionScheduler::Schedule(std::size_t slot, double time)
+{
+  Cancel(slot);
+  times_[slot] = time;
+
+  if (queue_.size() == queue_.capacity()) {
+    Compact();
+  }
+  queue_.push_back(Event { time, slot, versions_[slot] });
+  std::push_heap(queue_.begin(), queue_.end(), Later {});
+}
+
+// cancels the contact scheduled for the ball in the slot
+void CollisionScheduler::Cancel(std::size_t slot)
+{
+  // the entry in the queue becomes invalid
+  versions_[slot]++;
+  times_[slot] = -std::numeric_limits<double>::infinity();
+}
+
+// cancels the contacts scheduled for all the balls
+void CollisionScheduler::CancelAll()
+{
+  queue_.clear();
+  for (std::size_t slot = 0; slot < versions_.size(); slot++) {
+    Cancel(slot);
+  }
+}
+
+// returns the time of the earliest contact scheduled, or infinity if nothing
+// is scheduled; discards the invalidated entries on the way
+double CollisionScheduler::NextEventTime()
+{
+  while (!queue_.empty() && !IsValid(queue_.front())) {
+    std::pop_heap(queue_.begin(), queue_.end(), Later {});
+    queue_.pop_back();
+  }
+  return queue_.empty() ? std::numeric_limits<double>::infinity()
+                        : queue_.front().time;
+}
+
+// removes all the invalidated events; called when they fill most of the queue,
+// as a game which never asks for the next event never pops them
+void CollisionScheduler::Compact()
+{
+  queue_.erase(std::remove_if(queue_.begin(), queue_.end(),
+                   [this](const Event& event) { return !IsValid(event); }),
+      queue_.end());
+  std::make_heap(queue_.begin(), queue_.end(), Later {});
+}
@@ -8,8 +8,7 @@ Controller::Controller(Game& game)
 }
 
 // Handles all the input events
-// Takes the paddle and ball to synchronise game control
-void Controller::HandleInput(bool& running, Paddle& paddle, Ball& ball) const
+void Controller::HandleInput() const
 {
   // get all SDL events
   SDL_Event evt;
@@ -17,12 +16,16 @@ void Controller::HandleInput(bool& running, Paddle& paddle, Ball& ball) const
   while (SDL_PollEvent(&evt)) {
     // handle quit event (like "close window" button)
     if (evt.type == SDL_QUIT) {
-      running = false;
+      game_.Quit();
+    }
+    // the contents of the render targets have been lost
+    if (evt.type == SDL_RENDER_TARGETS_RESET) {
+      game_.InvalidateCachedGraphics();
     }
     // dispatch the rest event handling to helpers depending on the game state
     switch (game_.State()) {
       case GameState::Routine:
-        HandleRoutineEvents(paddle, ball);
+        HandleRoutineEvents();
         break;
       case GameState::Paused:
         HandlePausedEvents();
@@ -52,55 +55,45 @@ void Controller::HandlePausedEvents() const
 }
 
 // handles input events specific to the game routine running
-void Controller::HandleRoutineEvents(Paddle& paddle, Ball& ball) const
+void Controller::HandleRoutineEvents() const
 {
   // get the current keyboard state
   const Uint8* keysArray { SDL_GetKeyboardState(NULL) };
   // move the paddle up when the key: up_ is pressed
   if (keysArray[up_]) {
-    // move paddle up only if it has not outrun the ball
-    // (with some reasonable margin)
-    // helps avoid visual apearance of ball overlaping the paddle
-    // when ball hits the paddle but the paddle is still moving up
-    if (gMath::VerticalDistance(paddle.Position(), ball.Position())
-        > paddle.HalfHeight() + 5 * ball.Radius()) {
-      paddle.MoveUp();
-    }
+    game_.PostCommand(PlayerCommand::MoveUp);
   }
   // move the paddle down when the key: down_ is pressed
   else if (keysArray[down_]) {
-    paddle.MoveDown();
+    game_.PostCommand(PlayerCommand::MoveDown);
   }
   // move the paddle down when the key: left_ is pressed
   else if (keysArray[left_]) {
-    paddle.MoveLeft();
+    game_.PostCommand(PlayerCommand::MoveLeft);
   }
   // move the paddle right when the key: right_ is pressed
   else if (keysArray[right_]) {
-    paddle.MoveRight();
+    game_.PostCommand(PlayerCommand::MoveRight);
   }
   // apply left spin when the key: spin_left_ is pressed
   else if (keysArray[spin_left_]) {
-    ball.SetSpin(Spin::Left);
+    game_.PostCommand(PlayerCommand::SpinLeft);
   }
   // apply right spin when the key: spin_right_ is pressed
   else if (keysArray[spin_right_]) {
-    ball.SetSpin(Spin::Right);
+    game_.PostCommand(PlayerCommand::SpinRight);
   }
   // increase the ball speed when the key: speed_up_ is pressed
   else if (keysArray[speed_up_]) {
-    ball.SetSpeedDelta(game_.SpeedIncrement());
+    game_.PostCommand(PlayerCommand::SpeedUp);
   }
   // decrease the ball speed when the key: slow_down_ is pressed
   else if (keysArray[slow_down_]) {
-    ball.SetSpeedDelta(-25.0f);
+    game_.PostCommand(PlayerCommand::SlowDown);
   }
   // start the ball from the paddle when the key: start_ is pressed
   else if (keysArray[start_]) {
-    // start the ball only if it is in the starting position
-    if (!ball.IsMoving() && game_.State() == GameState::Routine) {
-      ball.Start();
-    }
+    game_.PostCommand(PlayerCommand::StartBall);
   }
   // pause the game when the pause key is pressed
   else if (keysArray[pause_key_]) {
@@ -108,9 +101,7 @@ void Controller::HandleRoutineEvents(Paddle& paddle, Ball& ball) const
   }
   // actions to be executed whenever the above keys are not pressed
   else {
-    paddle.Stop();
-    ball.SetSpin(Spin::None);
-    ball.SetSpeedDelta(0.0f);
+    game_.PostCommand(PlayerCommand::None);
   }
 }
 
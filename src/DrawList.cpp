@@ -0,0 +1,86 @@
+#include "DrawList.hpp"
+#include <algorithm>
+#include <functional>
+
+// adds a command for copying the source rectangle of the texture to the
+// destination rectangle of the screen within the given layer
+void DrawList::Add(DrawLayer layer, SDL_Texture* texture,
+    const SDL_Rect& source, const SDL_FRect& destination, SDL_Color tint)
+{
+  commands_.push_back(DrawCommand { texture, source, destination, tint, layer,
+    static_cast<std::uint32_t>(commands_.size()) });
+}
+
+// draws all the commands in the order of layers and empties the list
+void DrawList::Submit(SDL_Renderer* sdlRenderer)
+{
+  std::sort(commands_.begin(), commands_.end(),
+      [](const DrawCommand& lhs, const DrawCommand& rhs) {
+        if (lhs.layer != rhs.layer) {
+          return lhs.layer < rhs.layer;
+        }
+        if (lhs.texture != rhs.texture) {
+          return std::less<SDL_Texture*> {}(lhs.texture, rhs.texture);
+        }
+        return lhs.sequence < rhs.sequence;
+      });
+
+  // every run of commands with the same texture is a single batch
+  auto first = commands_.begin();
+  while (first != commands_.end()) {
+    SDL_Texture* texture = first->texture;
+    int width { 1 };
+    int height { 1 };
+    SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+
+    auto last = first;
+    for (; last != commands_.end() && last->texture == texture; ++last) {
+      AddQuad(*last, static_cast<float>(width), static_cast<float>(height));
+    }
+
+    // SDL_RenderGeometry() needs SDL 2.0.18 or newer
+    SDL_RenderGeometry(sdlRenderer, texture, vertices_.data(),
+        static_cast<int>(vertices_.size()), indices_.data(),
+        static_cast<int>(indices_.size()));
+    // keep the capacity of the buffers for the next batch
+    vertices_.clear();
+    indices_.clear();
+    first = last;
+  }
+  commands_.clear();
+}
+
+// adds the quad of the command to the vertex and index buffers; takes the size
+// of the texture of the command
+void DrawList::AddQuad(
+    const DrawCommand& command, float textureWidth, float textureHeight)
+{
+  const SDL_FRect& dst = command.destination;
+  const float left = dst.x;
+  const float top = dst.y;
+  const float right = dst.x + dst.w;
+  const float bottom = dst.y + dst.h;
+
+  // texture coordinates of the source rectangle
+  const SDL_Rect& src = command.source;
+  const float u_left = src.x / textureWidth;
+  const float v_top = src.y / textureHeight;
+  const float u_right = (src.x + src.w) / textureWidth;
+  const float v_bottom = (src.y + src.h) / textureHeight;
+
+  const SDL_Color tint = command.tint;
+  const int first = static_cast<int>(vertices_.size());
+  vertices_.push_back(SDL_Vertex { { left, top }, tint, { u_left, v_top } });
+  vertices_.push_back(
+      SDL_Vertex { { right, top }, tint, { u_right, v_top } });
+  vertices_.push_back(
+      SDL_Vertex { { right, bottom }, tint, { u_right, v_bottom } });
+  vertices_.push_back(
+      SDL_Vertex { { left, bottom }, tint, { u_left, v_bottom } });
+
+  // two triangles covering the quad
+  const int quad_indices[] = { 0, 1, 2, 0, 2, 3 };
+  for (int index : quad_indices) {
+    indices_.push_back(first + index);
+  }
+}
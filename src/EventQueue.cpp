@@ -0,0 +1,21 @@
+#include "EventQueue.hpp"
+
+// records the event awarding the given points
+void EventQueue::Push(GameEvent type, unsigned points)
+{
+  std::size_t& position = index_[Kind(type)];
+  // the first occurrence gets its own record
+  if (position == none) {
+    position = size_++;
+    records_[position] = EventRecord { type, 0, 0 };
+  }
+  records_[position].count++;
+  records_[position].points += points;
+}
+
+// removes all the records
+void EventQueue::Clear()
+{
+  index_.fill(none);
+  size_ = 0;
+}
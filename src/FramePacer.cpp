@@ -0,0 +1,86 @@
+#include "FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+// Constructor. Takes the target frame rate (frames per second) and the time
+// before the frame start at which sleeping is replaced by spinning.
+// Throws std::invalid_argument if the frame rate is not positive or the spin
+// margin is negative
+FramePacer::FramePacer(
+    double framesPerSecond, std::chrono::microseconds spinMargin)
+    : frame_duration_(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(
+            framesPerSecond > 0.0 ? 1.0 / framesPerSecond : 0.0)))
+    , spin_margin_(spinMargin)
+    , next_frame_(Clock::now() + frame_duration_)
+    , previous_frame_(Clock::now())
+{
+  if (framesPerSecond <= 0.0 || spinMargin.count() < 0) {
+    throw std::invalid_argument(
+        "Invalid arguments passed to the FramePacer constructor");
+  }
+}
+
+// waits until the start of the next frame and measures the interval since the
+// start of the previous one
+void FramePacer::WaitForNextFrame()
+{
+  // sleep coarsely while there is enough time left...
+  Clock::time_point now = Clock::now();
+  if (next_frame_ - now > spin_margin_) {
+    std::this_thread::sleep_for(next_frame_ - now - spin_margin_);
+  }
+  // ...and give up the processor in a loop for the last stretch
+  while ((now = Clock::now()) < next_frame_) {
+    std::this_thread::yield();
+  }
+
+  // follow the fixed schedule, unless the frame is more than a whole frame
+  // late - then the missed frames are skipped instead of being rushed
+  next_frame_ += frame_duration_;
+  if (next_frame_ < now) {
+    next_frame_ = now + frame_duration_;
+  }
+
+  // measure the frame interval
+  const double interval
+      = std::chrono::duration<double, std::milli>(now - previous_frame_)
+            .count();
+  previous_frame_ = now;
+  frames_++;
+  const double deviation = interval - mean_;
+  mean_ += deviation / frames_;
+  squared_deviations_ += deviation * (interval - mean_);
+  min_ = frames_ == 1 ? interval : std::min(min_, interval);
+  max_ = frames_ == 1 ? interval : std::max(max_, interval);
+}
+
+// restarts the schedule from now, e.g. after the main loop was halted for
+// displaying an info screen; the halted interval is not measured
+void FramePacer::Restart()
+{
+  previous_frame_ = Clock::now();
+  next_frame_ = previous_frame_ + frame_duration_;
+}
+
+// returns the statistics of the frame intervals measured since they were taken
+// last time and starts measuring anew
+FrameStats FramePacer::TakeStats()
+{
+  FrameStats stats;
+  stats.frames = frames_;
+  stats.mean_ms = mean_;
+  stats.jitter_ms
+      = frames_ > 1 ? std::sqrt(squared_deviations_ / frames_) : 0.0;
+  stats.min_ms = min_;
+  stats.max_ms = max_;
+
+  frames_ = 0;
+  mean_ = 0.0;
+  squared_deviations_ = 0.0;
+  min_ = 0.0;
+  max_ = 0.0;
+  return stats;
+}
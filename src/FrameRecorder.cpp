@@ -0,0 +1,210 @@
+#include "FrameRecorder.hpp"
+#include "SDL_image.h"
+#include "SDLexception.hpp"
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+// Constructor. Takes the path of the recording (the video file, or the prefix
+// of the names of the images), its format, the size of the frames, the frame
+// rate written into the video header and the number of frame buffers. Throws
+// std::invalid_argument if the size or the number of buffers is 0 and
+// std::runtime_error if the video file can't be created
+FrameRecorder::FrameRecorder(const std::string& path, CaptureFormat format,
+    std::size_t width, std::size_t height, std::size_t frameRate,
+    std::size_t bufferCount)
+    : path_(path)
+    , format_(format)
+    , width_(width)
+    , height_(height)
+{
+  if (width_ == 0 || height_ == 0 || bufferCount == 0) {
+    throw std::invalid_argument(
+        "Frame size and number of frame buffers must be greater than 0!");
+  }
+
+  if (format_ == CaptureFormat::Y4m) {
+    video_.open(path_, std::ios::binary | std::ios::trunc);
+    if (!video_) {
+      throw std::runtime_error("Could not create video file: " + path_);
+    }
+    // full frames, square pixels and no chroma subsampling, so the RGB
+    // pixels are converted pixel by pixel
+    video_ << "YUV4MPEG2 W" << width_ << " H" << height_ << " F" << frameRate
+           << ":1 Ip A1:1 C444\n";
+    planes_.resize(width_ * height_ * 3);
+  }
+
+  // the only allocations of the frame buffers
+  buffers_.resize(bufferCount);
+  for (std::size_t i = 0; i < bufferCount; i++) {
+    buffers_[i].resize(width_ * height_ * 4);
+    free_buffers_.push_back(i);
+  }
+
+  writer_ = std::thread([this] { RunWriter(); });
+}
+
+// Destructor. Writes the frames still waiting and stops the writer thread
+FrameRecorder::~FrameRecorder()
+{
+  Finish();
+}
+
+// Reads the frame rendered so far back from the renderer (to be called before
+// presenting it) and queues it for writing, or drops it if no buffer is free.
+// Never waits for the writer. Rethrows the exception which stopped the writer
+// thread, if any, and throws SDLexception if reading the pixels fails
+void FrameRecorder::Capture(SDL_Renderer* sdlRenderer)
+{
+  if (writer_failed_) {
+    std::rethrow_exception(writer_error_);
+  }
+
+  std::size_t index { 0 };
+  {
+    std::lock_guard<std::mutex> lock { mutex_ };
+    if (finishing_) {
+      return;
+    }
+    // the writer is behind; losing a frame is better than stalling the game
+    if (free_buffers_.empty()) {
+      frames_dropped_++;
+      return;
+    }
+    index = free_buffers_.back();
+    free_buffers_.pop_back();
+  }
+
+  // the buffer is owned by the capturing thread until it is queued
+  std::vector<std::uint8_t>& pixels = buffers_[index];
+  if (SDL_RenderReadPixels(sdlRenderer, nullptr, SDL_PIXELFORMAT_RGBA32,
+          pixels.data(), static_cast<int>(width_ * 4))
+      != 0) {
+    std::lock_guard<std::mutex> lock { mutex_ };
+    free_buffers_.push_back(index);
+    throw SDLexception("Failed to read the frame pixels", SDL_GetError(),
+        __FILE__, __LINE__);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock { mutex_ };
+    filled_buffers_.push_back(index);
+  }
+  frame_queued_.notify_one();
+}
+
+// writes all the queued frames and stops the writer thread; capturing further
+// frames drops them
+void FrameRecorder::Finish()
+{
+  {
+    std::lock_guard<std::mutex> lock { mutex_ };
+    finishing_ = true;
+  }
+  frame_queued_.notify_one();
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+  if (video_.is_open()) {
+    video_.close();
+  }
+}
+
+// WRITER THREAD: writes the queued frames until the recording finishes
+void FrameRecorder::RunWriter()
+{
+  try {
+    while (true) {
+      std::size_t index { 0 };
+      {
+        std::unique_lock<std::mutex> lock { mutex_ };
+        frame_queued_.wait(
+            lock, [this] { return finishing_ || !filled_buffers_.empty(); });
+        // the frames queued before finishing are written all the same
+        if (filled_buffers_.empty()) {
+          return;
+        }
+        index = filled_buffers_.front();
+        filled_buffers_.pop_front();
+      }
+
+      // the disk is accessed without holding the lock, so capturing goes on
+      if (format_ == CaptureFormat::Y4m) {
+        WriteY4mFrame(buffers_[index]);
+      }
+      else {
+        WritePngFrame(buffers_[index]);
+      }
+      frames_written_++;
+
+      std::lock_guard<std::mutex> lock { mutex_ };
+      free_buffers_.push_back(index);
+    }
+  }
+  catch (...) {
+    // the exception is rethrown by the next capture
+    writer_error_ = std::current_exception();
+    writer_failed_ = true;
+    std::lock_guard<std::mutex> lock { mutex_ };
+    finishing_ = true;
+  }
+}
+
+// WRITER THREAD: appends the frame to the Y4M stream
+void FrameRecorder::WriteY4mFrame(const std::vector<std::uint8_t>& pixels)
+{
+  const std::size_t plane_size = width_ * height_;
+  std::uint8_t* luma = planes_.data();
+  std::uint8_t* blue_diff = luma + plane_size;
+  std::uint8_t* red_diff = blue_diff + plane_size;
+
+  // BT.601 studio swing conversion in integer arithmetic
+  for (std::size_t i = 0; i < plane_size; i++) {
+    const int r = pixels[i * 4];
+    const int g = pixels[i * 4 + 1];
+    const int b = pixels[i * 4 + 2];
+    luma[i] = static_cast<std::uint8_t>(
+        ((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+    blue_diff[i] = static_cast<std::uint8_t>(
+        ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+    red_diff[i] = static_cast<std::uint8_t>(
+        ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+  }
+
+  video_ << "FRAME\n";
+  video_.write(reinterpret_cast<const char*>(planes_.data()),
+      static_cast<std::streamsize>(planes_.size()));
+  if (!video_) {
+    throw std::runtime_error("Could not write to video file: " + path_);
+  }
+}
+
+// WRITER THREAD: saves the frame as the next PNG image of the sequence
+void FrameRecorder::WritePngFrame(const std::vector<std::uint8_t>& pixels)
+{
+  // the surface only wraps the buffer; custom deleter is used due to specific
+  // SDL surface destruction function
+  std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface*)>> surface {
+    SDL_CreateRGBSurfaceWithFormatFrom(
+        const_cast<std::uint8_t*>(pixels.data()), static_cast<int>(width_),
+        static_cast<int>(height_), 32, static_cast<int>(width_ * 4),
+        SDL_PIXELFORMAT_RGBA32),
+    [](SDL_Surface* ptr) { SDL_FreeSurface(ptr); }
+  };
+  if (!surface) {
+    throw SDLexception("Failed to wrap the frame pixels", SDL_GetError(),
+        __FILE__, __LINE__);
+  }
+
+  // numbered from 0, so the images sort in the order of the frames
+  std::ostringstream name;
+  name << path_ << '_' << std::setw(6) << std::setfill('0')
+       << frames_written_.load() << ".png";
+  if (IMG_SavePNG(surface.get(), name.str().c_str()) != 0) {
+    throw SDLexception("Failed to save the frame image", IMG_GetError(),
+        __FILE__, __LINE__);
+  }
+}
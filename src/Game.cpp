@@ -1,87 +1,171 @@
 #include "Game.hpp"
 #include "Colors.hpp"
 #include "IntervalTimer.hpp"
-#include "LimitTimer.hpp"
 #include "Paths.hpp"
 #include "SDL.h"
 #include "SDLexception.hpp"
 #include <algorithm>
 #include <exception>
+#include <future>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+// returns the path of the asset pack: next to the executable if its directory
+// is known, in the working directory otherwise
+std::string AssetPackPath()
+{
+  char* base_path = SDL_GetBasePath();
+  if (!base_path) {
+    return Paths::pAssetPack;
+  }
+  std::string pack_path = base_path + Paths::pAssetPack;
+  SDL_free(base_path);
+  return pack_path;
+}
+}
 
-// Constructor. Takes game window height and width, desired FPS rate and numbers
-// off game levels implemented.
+// Constructor. Takes game window height and width, desired FPS rate,
+// simulation tick rate (fixed updates per second), numbers off game levels
+// implemented, the mode of rendering and the seed of the random numbers used in
+// the game. In the offscreen mode the game is played by the autopilot (and
+// restarted when over), as there is no player watching it, and simulated in
+// lockstep with the rendered frames, so the same seed always gives the same
+// frames.
 // Subobjects will throw exceptions if initialization fails (SDLexception and
 // exceptions derived from std::exception)
 Game::Game(const std::size_t screenHeight, const std::size_t screenWidth,
-    const std::size_t targetFrameRate, unsigned levelsImplemented)
+    const std::size_t targetFrameRate, const std::size_t simulationRate,
+    unsigned levelsImplemented, RenderMode renderMode, std::uint64_t seed)
     : // try to initialize SDL video and audio subsystems
     sdl_initializer_(SDLinitializer(SDL_INIT_VIDEO | SDL_INIT_AUDIO))
     // try to initialize SDL_Image support for PNG files
     , image_initializer_(ImageInitializer(IMG_INIT_PNG))
     // try to initialize True Type Font support
     , ttf_initializer_(TTFinitializer())
+    // map the asset pack, if there is one
+    , assets_(AssetPackPath())
     , screen_height_(screenHeight)
     , screen_width_(screenWidth)
-    , renderer_(std::make_unique<Renderer>(screenHeight, screenWidth))
-    , max_level_(levelsImplemented)
+    , renderer_(
+          std::make_unique<Renderer>(screenHeight, screenWidth, renderMode))
     , frame_rate_(targetFrameRate)
+    , frame_pacer_(static_cast<double>(targetFrameRate))
+    , simulation_rate_(simulationRate)
+    , fixed_time_step_(1.0f / simulationRate)
+    , lockstep_(renderMode == RenderMode::Offscreen)
+    // the simulation measures the time it simulates, so it doesn't need to
+    // wake up precisely and can sleep all the time between the updates
+    , simulation_pacer_(static_cast<double>(simulationRate),
+          std::chrono::microseconds(0))
+    , text_engine_(std::make_unique<TextEngine>(
+          renderer_->GetSDLrenderer(), assets_))
+    , pause_screen_(*text_engine_)
+    , ball_lost_screen_(*text_engine_)
+    , level_completed_screen_(*text_engine_)
+    , game_over_screen_(*text_engine_)
+    , game_won_screen_(*text_engine_)
     , audio_(nullptr)
     , controller_(std::make_unique<Controller>(*this))
-    // load all the data for the first level
-    , level_data_(std::make_unique<LevelData>(Paths::pLevels))
-    , balls_remaining_(level_data_->Lives())
 {
-  // load images used in the game
-  LoadImages();
-
-  // Initialize audio mixer system and load all the sound
-  // effects to be used in the game
-  LoadAudio();
+  // the simulation needs to tick at least once per second to make any sense
+  if (simulationRate == 0) {
+    throw std::invalid_argument("Simulation rate must be greater than 0!");
+  }
 
-  // reserve space in the cointainer storing pointers of static
-  // objects to be displayed in the game
-  static_for_game_screen_.reserve(
-      LevelData::max_rows * LevelData::row_size + 3);
+  // Initialize audio mixer system and load all the sound effects to be used
+  // in the game on another thread, while the images are loaded, so the
+  // startup takes as long as the slowest of the assets
+  std::future<void> audio_loaded
+      = std::async(std::launch::async, [this] { LoadAudio(); });
 
-  // Create all the game visible components
-  CreateWalls();
-  CreateBlocks();
-  CreatePaddle();
-  CreateBall();
+  // load images used in the game
+  LoadImages();
+  // rethrows the exception thrown while loading the sounds, if any
+  audio_loaded.get();
+
+  // create the game core with the first level loaded and start listening to
+  // its events
+  arena_ = std::make_unique<Arena>(CreateLayout(), Paths::pLevels,
+      levelsImplemented, seed, assets_.Pack());
+  arena_->SetListener(this);
+
+  // the counters of the game are displayed at the bottom of the screen,
+  // behind the game objects
+  hud_ = std::make_unique<Hud>(*text_engine_,
+      static_cast<float>(screen_width_), screen_height_ - 40.0f);
+
+  // the whole game area is displayed as a single object
+  arena_view_ = std::make_unique<ArenaView>(
+      *arena_, *atlas_, renderer_->GetSDLrenderer());
+
+  // build all the info screens, so they are only updated when displayed
+  CreatePauseScreen();
+  CreateBallLostScreen();
+  CreateLevelCompletedScreen();
+  CreateGameOverScreen();
+  CreateGameWonScreen();
+
+  // nobody can unpause the game offscreen, so it is played by the autopilot
+  // from the start
+  if (renderer_->IsOffscreen()) {
+    autopilot_.emplace();
+    state_ = GameState::Routine;
+  }
 
-  // create all displayable text elements which will not change in the game
-  CreateTexts();
+  // the first snapshot to be displayed; the simulation thread isn't running
+  // yet, so it can be published from here
+  PublishSnapshot();
 }
 
-// runs the game; implements main game loop
-void Game::Run()
+// stops the simulation thread; the rest of the resources is released by RAII
+Game::~Game()
 {
-  // calculate desired duration of a single frame
-  const Uint32 desired_frame_duration { static_cast<Uint32>(
-      IntervalTimer::ticks_per_second / frame_rate_) };
+  StopSimulation();
+}
 
-  // create timer used for for FPS limiting
-  LimitTimer frame_timer { desired_frame_duration };
+// Runs the game; implements main game loop. Stops after the given number of
+// frames, unless it is 0. Rethrows the exception which stopped the simulation
+// thread, if any
+void Game::Run(std::size_t maxFrames)
+{
+  std::size_t frames { 0 };
+  // the arena is updated on its own thread from now on, unless it is updated
+  // in lockstep with the frames
+  if (!lockstep_) {
+    simulation_thread_ = std::thread([this] { RunSimulation(); });
+  }
+  // start the frame schedule from now
+  frame_pacer_.Restart();
 
   // main game loop
   while (is_running_) {
     // handle the game input
-    controller_->HandleInput(is_running_, *paddle_, *ball_);
+    controller_->HandleInput();
+    // the simulation makes the same number of steps for every frame, whatever
+    // the time it takes to render it
+    if (lockstep_) {
+      UpdateSimulation();
+    }
+
+    // display the latest state of the arena published by the simulation
+    snapshots_.Update();
+    const FrameSnapshot& snapshot = snapshots_.ReadBuffer();
 
     // depending on the current game state dispatch the control
     // to proper helper function
     switch (state_) {
       case GameState::Routine:
-        RoutineGameActions();
+        DisplayGameScreen(snapshot, InterpolationAlpha(snapshot));
         break;
       case GameState::Paused:
-        PausedGameActions();
+        DisplayPauseScreen(snapshot);
         break;
       case GameState::Over:
-        DisplayGameOverScreen();
+        DisplayGameOverScreen(snapshot);
         break;
       case GameState::Won:
-        DisplayGameWonScreen();
+        DisplayGameWonScreen(snapshot);
         break;
       default:
         // report error if unexpected game state was received
@@ -89,56 +173,210 @@ void Game::Run()
             "Uknown game state occured in the main game loop!");
     }
 
+    // every offscreen frame is reported by its hash, so whole runs can be
+    // compared frame by frame
+    if (renderer_->IsOffscreen()) {
+      ReportFrameHash(frames);
+    }
+
     // execute frame FPS limiting policy by waiting untill
-    // each frame time completes
-    frame_timer.waitTillExpire();
-    // restart frameTimer for the next frame
-    frame_timer.restart();
+    // the next frame starts
+    frame_pacer_.WaitForNextFrame();
+    // report frame statistics about every second
+    if (frame_pacer_.FramesMeasured() >= frame_rate_) {
+      renderer_->ShowFrameStats(frame_pacer_.TakeStats());
+    }
+    if (++frames == maxFrames) {
+      Quit();
+    }
+  }
+
+  StopSimulation();
+  if (simulation_error_) {
+    std::rethrow_exception(simulation_error_);
+  }
+
+  // write the frames still waiting and report the recording
+  if (recorder_) {
+    recorder_->Finish();
+    std::cout << "frames recorded: " << recorder_->FramesWritten()
+              << ", dropped: " << recorder_->FramesDropped() << std::endl;
   }
 }
 
-// Restarts the game
-void Game::Restart()
+// prints the number and the hash of the rendered frame to the standard output
+void Game::ReportFrameHash(std::size_t frame) const
 {
-  // Load level one once again
-  LoadNewLevel(1);
+  std::cout << "frame " << frame << " hash " << std::hex << std::setfill('0')
+            << std::setw(16) << renderer_->FrameHash() << std::dec
+            << std::setfill(' ') << '\n';
+}
 
-  total_points_ = 0;
+// Records the displayed frames to the given path in the given format (see
+// FrameRecorder) from now on. Throws std::runtime_error if the video file
+// can't be created
+void Game::Record(const std::string& path, CaptureFormat format)
+{
+  renderer_->SetRecorder(nullptr);
+  recorder_ = std::make_unique<FrameRecorder>(
+      path, format, screen_width_, screen_height_, frame_rate_);
+  renderer_->SetRecorder(recorder_.get());
+}
 
-  // mark correct game state
-  state_ = GameState::Routine;
+// Restarts the game
+void Game::Restart()
+{
+  // the arena is restarted by the simulation, which then marks the correct
+  // game state
+  restart_requested_ = true;
 }
 
 // pauses or unpauses the game (pause on/off)
 void Game::TogglePause()
 {
-  if (state_ == GameState::Paused) {
+  // the simulation may end the game meanwhile; that state must not be lost
+  GameState expected { GameState::Paused };
+  if (!state_.compare_exchange_strong(expected, GameState::Routine)) {
+    expected = GameState::Routine;
+    state_.compare_exchange_strong(expected, GameState::Paused);
+  }
+}
+
+// queues the command of the player to be applied by the simulation; a command
+// repeating the last queued one is coalesced with it
+void Game::PostCommand(PlayerCommand command)
+{
+  std::lock_guard<std::mutex> lock { commands_mutex_ };
+  // a held key posts the same command every frame; applying it once per
+  // update has the same effect
+  if (pending_commands_.empty() || pending_commands_.back() != command) {
+    pending_commands_.push_back(command);
+  }
+}
+
+// SIMULATION THREAD: the loop updating the arena until the game quits
+void Game::RunSimulation()
+{
+  try {
+    while (is_running_) {
+      UpdateSimulation();
+      // wait for the next simulation step
+      simulation_pacer_.WaitForNextFrame();
+    }
+  }
+  catch (...) {
+    // the exception is rethrown on the main thread
+    simulation_error_ = std::current_exception();
+    is_running_ = false;
+  }
+}
+
+// SIMULATION THREAD (the main thread in lockstep): a single update of the
+// simulation; restarts the game if requested, applies the commands of the
+// player and runs the simulation steps due, unless the simulation is halted
+void Game::UpdateSimulation()
+{
+  // the autopilot starts a new game when the previous one is over
+  const GameState state = state_;
+  if (autopilot_ && (state == GameState::Over || state == GameState::Won)) {
+    restart_requested_ = true;
+  }
+  if (restart_requested_.exchange(false)) {
+    // start from level one with no points
+    arena_->Restart();
+    interlude_ = Interlude::None;
+    PublishSnapshot();
+    // mark correct game state
     state_ = GameState::Routine;
   }
+
+  const bool simulating
+      = state_ == GameState::Routine && !IsInterludeRunning();
+  if (simulating) {
+    // the simulation clock must not run while the game is not running
+    if (!was_simulating_) {
+      ResetSimulationClock();
+    }
+    ApplyCommands();
+    RunSimulationSteps();
+    PublishSnapshot();
+  }
   else {
-    state_ = GameState::Paused;
+    DiscardCommands();
+  }
+  was_simulating_ = simulating;
+  // the lockstep clock counts the frames, halted or not
+  if (lockstep_) {
+    lockstep_frames_++;
+  }
+}
+
+// SIMULATION THREAD: applies the commands of the player queued since the
+// previous update
+void Game::ApplyCommands()
+{
+  {
+    std::lock_guard<std::mutex> lock { commands_mutex_ };
+    applied_commands_.swap(pending_commands_);
+  }
+  for (PlayerCommand command : applied_commands_) {
+    arena_->HandleCommand(command);
   }
+  applied_commands_.clear();
 }
 
-// Perfoms actions in routine game state
-void Game::RoutineGameActions()
+// SIMULATION THREAD: drops the commands of the player posted while the
+// simulation is halted, so they are not replayed at once when it resumes
+void Game::DiscardCommands()
 {
-  // update state of the game objects (ball, paddle, blocks, etc.)
-  UpdateGame();
-  // Display the game screen
-  renderer_->DisplayScreen(static_for_game_screen_, movable_for_game_screen_);
+  std::lock_guard<std::mutex> lock { commands_mutex_ };
+  pending_commands_.clear();
+}
 
-  // Load next level if all the blocks have been destroyed
-  if (std::all_of(blocks_.begin(), blocks_.end(),
-          [](const Block& block) { return block.IsDestroyed(); })) {
+// SIMULATION THREAD: runs as many fixed simulation steps as the time
+// accumulated since the previous update allows (limited by
+// max_steps_per_frame_), or the steps of a frame in lockstep, and loads the
+// next level if the current one was cleared
+void Game::RunSimulationSteps()
+{
+  if (lockstep_) {
+    // the steps of the frames are spread evenly even if the simulation rate
+    // is not a multiple of the frame rate
+    const auto frame = static_cast<std::uint64_t>(lockstep_frames_);
+    const auto steps = (frame + 1) * simulation_rate_ / frame_rate_
+        - frame * simulation_rate_ / frame_rate_;
+    RunFixedSteps(static_cast<unsigned>(steps));
+  }
+  else {
+    // add the real time passed since the previous update
+    time_accumulator_ += timer_.UpdateAndGetInterval();
+
+    // consume the accumulated time in equal steps, so the simulation behaves
+    // the same regardless of the update rate
+    const auto due = static_cast<unsigned>(std::min(
+        time_accumulator_ / fixed_time_step_,
+        static_cast<float>(max_steps_per_frame_)));
+    const unsigned steps = RunFixedSteps(due);
+    time_accumulator_ -= steps * fixed_time_step_;
+
+    // if the simulation could not catch up within the allowed number of
+    // steps, drop the backlog instead of carrying it into the following
+    // updates
+    if (steps == max_steps_per_frame_) {
+      time_accumulator_ = 0.0f;
+    }
+  }
+
+  // award the points, play the sounds and start the info screens for all the
+  // events of the update at once
+  arena_->DispatchEvents();
 
+  // Load next level if all the blocks have been destroyed
+  if (state_ == GameState::Routine && arena_->IsLevelCleared()) {
     // if loading a new level succeds
-    if (LoadNewLevel(level_data_->Level() + 1)) {
+    if (arena_->LoadLevel(arena_->Level() + 1)) {
       PlaySound(Sound::LevelCompleted);
-
-      DisplayLevelCompleted();
-      // halt execution for the the time of display;
-      SDL_Delay(4000);
+      StartInterlude(Interlude::LevelCompleted);
     }
     // LoadNewLevel returns fasle only when there are no more levels,
     // so the game is won
@@ -149,125 +387,126 @@ void Game::RoutineGameActions()
   }
 }
 
-// Perfoms actions in when the game is paused
-void Game::PausedGameActions()
+// SIMULATION THREAD: runs up to the given number of fixed simulation steps and
+// returns the number of steps made. Stops early if a ball was lost, so the
+// info screen is shown right away
+unsigned Game::RunFixedSteps(unsigned steps)
 {
-  // Pause the game timer for correct update calculations.
-  // If not paused, the game update calculations will break
-  // all the display after unpausing
-  timer_.Pause();
-
-  DisplayPauseScreen();
+  unsigned made { 0 };
+  while (made < steps && !arena_->Events().Contains(GameEvent::BallLost)) {
+    if (autopilot_) {
+      autopilot_->Steer(*arena_);
+    }
+    arena_->Update(fixed_time_step_);
+    made++;
+  }
+  return made;
 }
 
-// Loads new level. Returns true if new level loaded successfully,
-// false if the current level was the last one implemented
-bool Game::LoadNewLevel(unsigned newLevel)
+// SIMULATION THREAD: returns the time of the simulation clock: the real time,
+// or the time of the frames simulated in lockstep
+std::chrono::steady_clock::time_point Game::SimulationNow() const
 {
-  // if the current_level was the last one implemented,
-  // false indicates that the game has reached the end
-  if (newLevel > max_level_) {
-    return false;
+  if (!lockstep_) {
+    return std::chrono::steady_clock::now();
   }
+  return std::chrono::steady_clock::time_point {}
+      + std::chrono::nanoseconds(static_cast<std::int64_t>(
+          lockstep_frames_ * std::uint64_t { 1000000000 } / frame_rate_));
+}
 
-  // load all the data for the new level
-  level_data_ = std::make_unique<LevelData>(Paths::pLevels, newLevel);
-
-  // set player ramaining balls/lives
-  balls_remaining_ = (level_data_->Lives());
-
-  // clear the vector of static objects to be displayed
-  // and reserve enough space for new, reloaded one
-  static_for_game_screen_.clear();
-  static_for_game_screen_.reserve(
-      LevelData::max_rows * LevelData::row_size + 3);
-
-  // add walls to the list of static objects to be displayed
-  for (auto& wall : side_walls_) {
-    static_for_game_screen_.emplace_back(&wall);
-  };
+// SIMULATION THREAD: drops the time accumulated by the simulation, e.g. after
+// the simulation was halted for displaying an info screen
+void Game::ResetSimulationClock()
+{
+  // the next timer interval will start from now
+  timer_.Pause();
+  time_accumulator_ = 0.0f;
+}
 
-  // empty the container of blocks and create  new ones for the level
-  blocks_.clear();
-  CreateBlocks();
+// SIMULATION THREAD: halts the simulation for the time of displaying the info
+// screen
+void Game::StartInterlude(Interlude interlude)
+{
+  interlude_ = interlude;
+  interlude_end_ = SimulationNow() + interlude_duration_;
+}
 
-  // set paddle position to default and speed to paddle level speed
-  paddle_->SetPosition(
-      screen_width_ / 2.0f, screen_height_ - paddle_->HalfHeight());
-  paddle_->SetSpeed(level_data_->PaddleSpeed());
+// SIMULATION THREAD: checks if the simulation is halted by an info screen
+bool Game::IsInterludeRunning()
+{
+  if (interlude_ != Interlude::None && SimulationNow() >= interlude_end_) {
+    // the info screen is replaced by the game screen with the next snapshot
+    interlude_ = Interlude::None;
+  }
+  return interlude_ != Interlude::None;
+}
 
-  // reset ball speed and place it on the paddle
-  ball_->Reset(level_data_->BallSpeed());
+// SIMULATION THREAD: publishes the snapshot of the arena to be displayed
+void Game::PublishSnapshot()
+{
+  FrameSnapshot& snapshot = snapshots_.WriteBuffer();
+  arena_->Capture(snapshot);
+  snapshot.time = SimulationNow();
+  snapshot.step_fraction = time_accumulator_ / fixed_time_step_;
+  // published in the same buffer, so the info screen is always displayed with
+  // the values of its own snapshot
+  snapshot.interlude = interlude_;
+  snapshots_.Publish();
+}
 
-  // level loaded succesfully
-  return true;
+// stops the simulation thread and waits until it finishes
+void Game::StopSimulation()
+{
+  is_running_ = false;
+  if (simulation_thread_.joinable()) {
+    simulation_thread_.join();
+  }
 }
 
-// updates the state of the game objects
-void Game::UpdateGame()
+// Returns the part (0 to 1) of the simulation step from the previous to the
+// current positions of the snapshot displayed now. The displayed positions are
+// one step behind the simulation, so they can always be interpolated
+float Game::InterpolationAlpha(const FrameSnapshot& snapshot) const
 {
-  // calculate delta time and udpate timer
-  auto delta_time = timer_.UpdateAndGetInterval();
-  // upate paddle state
-  paddle_->Update(delta_time);
-  // update ball state
-  ball_->Update(delta_time);
+  // every frame in lockstep ends with a whole simulation step
+  if (lockstep_) {
+    return 1.0f;
+  }
+  // the time simulated since the snapshot was taken is not in it yet
+  const std::chrono::duration<float> elapsed
+      = std::chrono::steady_clock::now() - snapshot.time;
+  const float alpha
+      = snapshot.step_fraction + elapsed.count() / fixed_time_step_;
+  // a late snapshot (e.g. the simulation halted) shows the current positions
+  return std::clamp(alpha, 0.0f, 1.0f);
 }
 
-// load all image textures used in the game
+// loads all the images used in the game into the sprite atlas
 void Game::LoadImages()
 {
-  // load texture representing the ball
-  images_[Sprite::Ball]
-      = Texture(Paths::pBallImage, renderer_->GetSDLrenderer());
-
-  // load texture respresenting the paddle
-  images_[Sprite::Paddle]
-      = Texture(Paths::pPadleImage, renderer_->GetSDLrenderer());
-
-  // load texture representing the top_wall
-  images_[Sprite::WallHorizontal]
-      = Texture(Paths::pHorizontalWallImage, renderer_->GetSDLrenderer());
-
-  // load texture representing side_walls
-  images_[Sprite::WallVertical]
-      = Texture(Paths::pVerticalWallImage, renderer_->GetSDLrenderer());
-
-  // load texture representing a green block
-  images_[Sprite::BlockGreen]
-      = Texture(Paths::pBlockGreenImage, renderer_->GetSDLrenderer());
-
-  // load texture representing a silver block
-  images_[Sprite::BlockSilver]
-      = Texture(Paths::pBlockSilverImage, renderer_->GetSDLrenderer());
-
-  // load texture representing a blue block
-  images_[Sprite::BlockBlue]
-      = Texture(Paths::pBlockBlueImage, renderer_->GetSDLrenderer());
-
-  // load texture representing an orange block
-  images_[Sprite::BlockOrange]
-      = Texture(Paths::pBlockOrangeImage, renderer_->GetSDLrenderer());
-
-  // load texture representing a purple block
-  images_[Sprite::BlockPurple]
-      = Texture(Paths::pBlockPurpleImage, renderer_->GetSDLrenderer());
-
-  // load texture representing a red block
-  images_[Sprite::BlockRed]
-      = Texture(Paths::pBlockRedImage, renderer_->GetSDLrenderer());
-
-  // load texture representing a teal block
-  images_[Sprite::BlockTeal]
-      = Texture(Paths::pBlockTealImage, renderer_->GetSDLrenderer());
-
-  // load texture representing a yellow block
-  images_[Sprite::BlockYellow]
-      = Texture(Paths::pBlockYellowImage, renderer_->GetSDLrenderer());
+  const std::vector<std::pair<Sprite, std::string>> images {
+    { Sprite::Ball, Paths::pBallImage },
+    { Sprite::Paddle, Paths::pPadleImage },
+    { Sprite::WallHorizontal, Paths::pHorizontalWallImage },
+    { Sprite::WallVertical, Paths::pVerticalWallImage },
+    { Sprite::BlockGreen, Paths::pBlockGreenImage },
+    { Sprite::BlockSilver, Paths::pBlockSilverImage },
+    { Sprite::BlockBlue, Paths::pBlockBlueImage },
+    { Sprite::BlockOrange, Paths::pBlockOrangeImage },
+    { Sprite::BlockPurple, Paths::pBlockPurpleImage },
+    { Sprite::BlockRed, Paths::pBlockRedImage },
+    { Sprite::BlockTeal, Paths::pBlockTealImage },
+    { Sprite::BlockYellow, Paths::pBlockYellowImage }
+  };
+  // all the images are packed into a single texture
+  atlas_ = std::make_unique<SpriteAtlas>(
+      images, assets_, renderer_->GetSDLrenderer());
 }
 
 // Initializes audio mixer system and loads all the sound
-// effects to be used in the game
+// effects to be used in the game; uses no renderer, so it may run on another
+// thread
 void Game::LoadAudio()
 {
   // create map assigning paths of audio files to enum sound codes
@@ -279,11 +518,12 @@ void Game::LoadAudio()
           { Sound::LevelCompleted, Paths::pSoundLevelCompleted },
           { Sound::GameWon, Paths::pSoundGameWon } };
   // create audio mixer sending the created container
-  audio_ = std::make_unique<AudioMixer>(sound_vs_path);
+  audio_ = std::make_unique<AudioMixer>(sound_vs_path, assets_);
 }
 
-// creates all the texts which won't change for the entire game
-void Game::CreateTexts()
+// builds the pause screen: the game title, the game controls and the counters
+// of balls, level and score
+void Game::CreatePauseScreen()
 {
   // helper const for marking centre x position
   const float horizontal_centre = screen_width_ / 2.0f;
@@ -292,29 +532,29 @@ void Game::CreateTexts()
   std::string top { "Thank's for trying out my game:" };
   const float top_x = horizontal_centre;
   const float top_y = 30.0f;
-  texts_.emplace_back(top_x, top_y, Paths::pFontRobotoRegular, Color::Yellow,
-      30, renderer_->GetSDLrenderer(), top);
+  pause_screen_.AddText(top_x, top_y, Paths::pFontRobotoRegular, Color::Yellow,
+      30, top);
 
   // Create text for game title
   std::string title { " s i m p l e   A r k a n o i d  ! ! !" };
   const float title_x = horizontal_centre;
   const float title_y = top_y + 70.0f;
-  texts_.emplace_back(title_x, title_y, Paths::pFontRobotoBoldItalic,
-      Color::Green, 70, renderer_->GetSDLrenderer(), title);
+  pause_screen_.AddText(title_x, title_y, Paths::pFontRobotoBoldItalic,
+      Color::Green, 70, title);
 
   // Create text about the paused state
   std::string paused { "Game PAUSED" };
   const float paused_x = horizontal_centre;
   const float paused_y = title_y + 70.0f;
-  texts_.emplace_back(paused_x, paused_y, Paths::pFontRobotoBold, Color::Red,
-      36, renderer_->GetSDLrenderer(), paused);
+  pause_screen_.AddText(paused_x, paused_y, Paths::pFontRobotoBold, Color::Red,
+      36, paused);
 
   // Create instruction about unpausing
   std::string unpause { "( press 'ESCAPE' key to unpause )" };
   const float unpause_x = horizontal_centre;
   const float unpause_y = paused_y + 40.0f;
-  texts_.emplace_back(unpause_x, unpause_y, Paths::pFontRobotoRegular,
-      Color::Red, 22, renderer_->GetSDLrenderer(), unpause);
+  pause_screen_.AddText(unpause_x, unpause_y, Paths::pFontRobotoRegular,
+      Color::Red, 22, unpause);
 
   // spacer for the area where dynamically created text whill apear
   const float spacer = 240.0f;
@@ -325,8 +565,8 @@ void Game::CreateTexts()
   };
   const float instr_x = horizontal_centre;
   const float instr_y = unpause_y + spacer;
-  texts_.emplace_back(instr_x, instr_y, Paths::pFontRobotoBold, Color::Violet,
-      32, renderer_->GetSDLrenderer(), instructions);
+  pause_screen_.AddText(instr_x, instr_y, Paths::pFontRobotoBold, Color::Violet,
+      32, instructions);
 
   // spacer between instructions
   const float instr_spacer = 35.0f;
@@ -334,15 +574,15 @@ void Game::CreateTexts()
   std::string line_1 { "S P A C E   -   start the ball from the paddle" };
   const float line_1_x = horizontal_centre;
   const float line_1_y = instr_y + instr_spacer + 10.0f;
-  texts_.emplace_back(line_1_x, line_1_y, Paths::pFontRobotoRegular,
-      Color::Yellow, 22, renderer_->GetSDLrenderer(), line_1);
+  pause_screen_.AddText(line_1_x, line_1_y, Paths::pFontRobotoRegular,
+      Color::Yellow, 22, line_1);
 
   // 2nd line of instructions
   std::string line_2 { "E S C A P E  -   pause / unpause the game" };
   const float line_2_x = horizontal_centre;
   const float line_2_y = line_1_y + instr_spacer;
-  texts_.emplace_back(line_2_x, line_2_y, Paths::pFontRobotoRegular,
-      Color::Orange, 22, renderer_->GetSDLrenderer(), line_2);
+  pause_screen_.AddText(line_2_x, line_2_y, Paths::pFontRobotoRegular,
+      Color::Orange, 22, line_2);
 
   // 3rd line of instructions
   std::string line_3 {
@@ -350,24 +590,24 @@ void Game::CreateTexts()
   };
   const float line_3_x = horizontal_centre;
   const float line_3_y = line_2_y + instr_spacer;
-  texts_.emplace_back(line_3_x, line_3_y, Paths::pFontRobotoRegular,
-      Color::Yellow, 22, renderer_->GetSDLrenderer(), line_3);
+  pause_screen_.AddText(line_3_x, line_3_y, Paths::pFontRobotoRegular,
+      Color::Yellow, 22, line_3);
 
   // 4th line of instructions
   std::string line_4 { "U P   and   D O W N   arrows  -  move the paddle "
                        "VERTICALLY (within allowed limits)" };
   const float line_4_x = horizontal_centre;
   const float line_4_y = line_3_y + instr_spacer;
-  texts_.emplace_back(line_4_x, line_4_y, Paths::pFontRobotoRegular,
-      Color::Orange, 22, renderer_->GetSDLrenderer(), line_4);
+  pause_screen_.AddText(line_4_x, line_4_y, Paths::pFontRobotoRegular,
+      Color::Orange, 22, line_4);
 
   // 5th line of instructions
   std::string line_5 { "THESE  WORK  ONLY  WHEN  HELD  WHILE  "
                        "THE  BALL  HITS  THE  PADDLE :" };
   const float line_5_x = horizontal_centre;
   const float line_5_y = line_4_y + instr_spacer + 10.0f;
-  texts_.emplace_back(line_5_x, line_5_y, Paths::pFontRobotoRegular,
-      Color::Violet, 26, renderer_->GetSDLrenderer(), line_5);
+  pause_screen_.AddText(line_5_x, line_5_y, Paths::pFontRobotoRegular,
+      Color::Violet, 26, line_5);
 
   // 6th line of instructions
   std::string line_6 {
@@ -375,178 +615,124 @@ void Game::CreateTexts()
   };
   const float line_6_x = horizontal_centre;
   const float line_6_y = line_5_y + instr_spacer;
-  texts_.emplace_back(line_6_x, line_6_y, Paths::pFontRobotoRegular,
-      Color::Orange, 22, renderer_->GetSDLrenderer(), line_6);
+  pause_screen_.AddText(line_6_x, line_6_y, Paths::pFontRobotoRegular,
+      Color::Orange, 22, line_6);
 
   // 7th line of instructions
   std::string line_7 { "E - speed up the ball (steps with no limit)     D - "
                        "slow down the ball (no more than  the level minimum)" };
   const float line_7_x = horizontal_centre;
   const float line_7_y = line_6_y + instr_spacer;
-  texts_.emplace_back(line_7_x, line_7_y, Paths::pFontRobotoRegular,
-      Color::Yellow, 22, renderer_->GetSDLrenderer(), line_7);
-}
-
-// Generates container of static objects to be displayed on the pause screen
-void Game::DisplayPauseScreen() const
-{
-  // create container of static objects to be displayed
-  std::vector<const StaticObject*> all_texts;
-  // reserve container space for all predicted elements
-  all_texts.reserve(texts_.size() + 6);
-
-  // copy addresses of all stored texts which won't change during game
-  for (auto& text : texts_) {
-    all_texts.emplace_back(&text);
-  }
+  pause_screen_.AddText(line_7_x, line_7_y, Paths::pFontRobotoRegular,
+      Color::Yellow, 22, line_7);
 
   // create remaining balls counter display
-  std::string balls_str { std::to_string(balls_remaining_) };
   const float balls_x = screen_width_ / 2.0f;
   const float balls_y = screen_height_ / 3.0f + 45.0f;
-  TextElement balls { balls_x, balls_y, Paths::pFontRobotoBold, Color::Yellow,
-    70, renderer_->GetSDLrenderer(), balls_str };
+  pause_balls_ = pause_screen_.AddValue(
+      balls_x, balls_y, Paths::pFontRobotoBold, Color::Yellow, 70);
 
   // create "remaining balls" text
   std::string remaining_str { "Balls left" };
   const float remaining_x = screen_width_ / 2.0f;
   const float remaining_y = balls_y + 70;
-  TextElement remaining { remaining_x, remaining_y, Paths::pFontRobotoBold,
-    Color::Yellow, 36, renderer_->GetSDLrenderer(), remaining_str };
+  const TextElement& remaining = pause_screen_.AddText(remaining_x,
+      remaining_y, Paths::pFontRobotoBold, Color::Yellow, 36, remaining_str);
 
   // create level counter display
-  std::string level_str { std::to_string(level_data_->Level()) };
   const float level_x
       = (remaining.Position().X() - (remaining.Width() / 2.0f)) / 2.0f;
   const float level_y = balls_y;
-  TextElement level { level_x, level_y, Paths::pFontRobotoBold, Color::Blue, 70,
-    renderer_->GetSDLrenderer(), level_str };
+  pause_level_ = pause_screen_.AddValue(
+      level_x, level_y, Paths::pFontRobotoBold, Color::Blue, 70);
 
   // create "level" text
   std::string lvl_txt_str { "Level" };
   const float lvl_txt_x = level_x;
   const float lvl_txt_y = remaining_y;
-  TextElement lvl_txt { lvl_txt_x, lvl_txt_y, Paths::pFontRobotoBold,
-    Color::Blue, 36, renderer_->GetSDLrenderer(), lvl_txt_str };
+  pause_screen_.AddText(lvl_txt_x, lvl_txt_y, Paths::pFontRobotoBold,
+      Color::Blue, 36, lvl_txt_str);
 
   // create total score counter display
-  std::string score_str { std::to_string(total_points_) };
   const float score_x = screen_width_ - level_x;
   const float score_y = balls_y;
-  TextElement score { score_x, score_y, Paths::pFontRobotoBold, Color::Green,
-    70, renderer_->GetSDLrenderer(), score_str };
+  pause_score_ = pause_screen_.AddValue(
+      score_x, score_y, Paths::pFontRobotoBold, Color::Green, 70);
 
   // create "score" text
   std::string score_txt_str { "SCORE" };
   const float score_txt_x = score_x;
   const float score_txt_y = lvl_txt_y;
-  TextElement score_txt { score_txt_x, score_txt_y, Paths::pFontRobotoBold,
-    Color::Green, 36, renderer_->GetSDLrenderer(), score_txt_str };
-
-  // add text elements to the container
-  all_texts.emplace_back(&remaining);
-  all_texts.emplace_back(&balls);
-  all_texts.emplace_back(&level);
-  all_texts.emplace_back(&lvl_txt);
-  all_texts.emplace_back(&score);
-  all_texts.emplace_back(&score_txt);
-
-  // Display all text on screen
-  renderer_->DisplayScreen(all_texts);
+  pause_screen_.AddText(score_txt_x, score_txt_y, Paths::pFontRobotoBold,
+      Color::Green, 36, score_txt_str);
 }
 
-// Displays the screen after ball leaving the screen
-void Game::DisplayBallLostScreen() const
+// builds the screen displayed after ball leaving the screen
+void Game::CreateBallLostScreen()
 {
-  // create container of static objects to be displayed
-  std::vector<const StaticObject*> texts;
-  // reserve container space for all predicted elements
-  texts.reserve(texts_.size() + 5);
-
   // create "ball lost" text
   std::string ball_out_str { " B A L L   L E F T " };
   const float ball_out_x = screen_width_ / 2.0f;
   const float ball_out_y = screen_height_ / 5.0f;
-  TextElement ball_out { ball_out_x, ball_out_y, Paths::pFontRobotoBold,
-    Color::Red, 90, renderer_->GetSDLrenderer(), ball_out_str };
+  ball_lost_screen_.AddText(ball_out_x, ball_out_y, Paths::pFontRobotoBold,
+      Color::Red, 90, ball_out_str);
 
   // create "ball lost" text - 2nd part
   std::string ball_out2_str { "T H E   S C R E E N" };
   const float ball_out2_x = screen_width_ / 2.0f;
   const float ball_out2_y = ball_out_y + 100.0f;
-  TextElement ball_2out { ball_out2_x, ball_out2_y, Paths::pFontRobotoBold,
-    Color::Red, 90, renderer_->GetSDLrenderer(), ball_out2_str };
+  ball_lost_screen_.AddText(ball_out2_x, ball_out2_y, Paths::pFontRobotoBold,
+      Color::Red, 90, ball_out2_str);
 
   // create remaining balls counter display
-  std::string balls_str { std::to_string(balls_remaining_) };
   const float balls_x = screen_width_ / 2.0f;
   const float balls_y = screen_height_ / 2.0f + 20.f;
-  TextElement balls { balls_x, balls_y, Paths::pFontRobotoBold, Color::Orange,
-    120, renderer_->GetSDLrenderer(), balls_str };
+  lost_balls_ = ball_lost_screen_.AddValue(
+      balls_x, balls_y, Paths::pFontRobotoBold, Color::Orange, 120);
 
   // create "remaining balls" text
   std::string remaining_str { "Ball(s) remaining" };
   const float remaining_x = screen_width_ / 2.0f;
   const float remaining_y = balls_y + 120;
-  TextElement remaining { remaining_x, remaining_y, Paths::pFontRobotoBold,
-    Color::Orange, 36, renderer_->GetSDLrenderer(), remaining_str };
+  ball_lost_screen_.AddText(remaining_x, remaining_y, Paths::pFontRobotoBold,
+      Color::Orange, 36, remaining_str);
 
   // create "resuming" text
   std::string resume_str { "Game will resume in a couple of seconds . . ." };
   const float resume_x = screen_width_ / 2.0f;
   const float resume_y = remaining_y + 100.0f;
-  TextElement resume { resume_x, resume_y, Paths::pFontRobotoBold, Color::Green,
-    45, renderer_->GetSDLrenderer(), resume_str };
-
-  // add text elements to the container
-  texts.emplace_back(&remaining);
-  texts.emplace_back(&balls);
-  texts.emplace_back(&ball_out);
-  texts.emplace_back(&resume);
-  texts.emplace_back(&ball_2out);
-
-  // Display all text on screen
-  renderer_->DisplayScreen(texts);
+  ball_lost_screen_.AddText(resume_x, resume_y, Paths::pFontRobotoBold,
+      Color::Green, 45, resume_str);
 }
 
-// Displays the screen after the level has been completed
-void Game::DisplayLevelCompleted() const
+// builds the screen displayed after the level has been completed
+void Game::CreateLevelCompletedScreen()
 {
-  // create container of static objects to be displayed
-  std::vector<const StaticObject*> texts;
-  // reserve container space for all predicted elements
-  texts.reserve(texts_.size() + 5);
-
-  // create "level" text
-  std::string completed_str { "L E V E L   " };
-  // need to decrease level number by one, because after loading
-  // a new level by now the counter is already set to new level
-  completed_str += std::to_string(level_data_->Level() - 1);
+  // create "level" text followed by the number of the completed level
   const float completed_x = screen_width_ / 2.0f;
   const float completed_y = screen_height_ / 6.0f;
-  TextElement completed { completed_x, completed_y, Paths::pFontRobotoBold,
-    Color::Orange, 60, renderer_->GetSDLrenderer(), completed_str };
+  completed_level_ = level_completed_screen_.AddValue(completed_x,
+      completed_y, Paths::pFontRobotoBold, Color::Orange, 60, "L E V E L   ");
 
   // create "congrats" text
   std::string congrats_str { "C O M P L E T E D ! ! !" };
   const float congrats_x = screen_width_ / 2.0f;
   const float congrats_y = completed_y + 110.0f;
-  TextElement congrats { congrats_x, congrats_y, Paths::pFontRobotoBold,
-    Color::Green, 80, renderer_->GetSDLrenderer(), congrats_str };
+  level_completed_screen_.AddText(congrats_x, congrats_y,
+      Paths::pFontRobotoBold, Color::Green, 80, congrats_str);
 
   // create total score counter display
-  std::string score_str { std::to_string(total_points_) };
   const float score_x = screen_width_ / 2.0f;
   const float score_y = screen_height_ / 2.0f;
-  TextElement score { score_x, score_y, Paths::pFontRobotoBold, Color::Yellow,
-    120, renderer_->GetSDLrenderer(), score_str };
+  completed_score_ = level_completed_screen_.AddValue(
+      score_x, score_y, Paths::pFontRobotoBold, Color::Yellow, 120);
 
   // create "total score" text
   std::string score_txt_str { "T O T A L   S C O R E" };
   const float score_txt_x = screen_width_ / 2.0f;
   const float score_txt_y = score_y + 100;
-  TextElement score_txt { score_txt_x, score_txt_y, Paths::pFontRobotoBold,
-    Color::Yellow, 36, renderer_->GetSDLrenderer(), score_txt_str };
+  level_completed_screen_.AddText(score_txt_x, score_txt_y,
+      Paths::pFontRobotoBold, Color::Yellow, 36, score_txt_str);
 
   // create info about starting a new level
   std::string starting_str {
@@ -554,55 +740,39 @@ void Game::DisplayLevelCompleted() const
   };
   const float starting_x = screen_width_ / 2.0f;
   const float starting_y = screen_height_ * 2.5f / 3.0f;
-  TextElement starting { starting_x, starting_y, Paths::pFontRobotoBold,
-    Color::Orange, 40, renderer_->GetSDLrenderer(), starting_str };
-
-  // add text elements to the container
-  texts.emplace_back(&completed);
-  texts.emplace_back(&congrats);
-  texts.emplace_back(&score);
-  texts.emplace_back(&score_txt);
-  texts.emplace_back(&starting);
-
-  // Display all text on screen
-  renderer_->DisplayScreen(texts);
+  level_completed_screen_.AddText(starting_x, starting_y,
+      Paths::pFontRobotoBold, Color::Orange, 40, starting_str);
 }
 
-// Displays the screen after all lives/balls have been lost
-void Game::DisplayGameOverScreen() const
+// builds the screen displayed after all lives/balls have been lost
+void Game::CreateGameOverScreen()
 {
-  // create container of static objects to be displayed
-  std::vector<const StaticObject*> texts;
-  // reserve container space for all predicted elements
-  texts.reserve(texts_.size() + 6);
-
   // create "game over" text
   std::string g_over_str { "G A M E    O V E R" };
   const float g_over_x = screen_width_ / 2.0f;
   const float g_over_y = screen_height_ / 5.0f;
-  TextElement g_over { g_over_x, g_over_y, Paths::pFontRobotoBold, Color::Red,
-    90, renderer_->GetSDLrenderer(), g_over_str };
+  game_over_screen_.AddText(g_over_x, g_over_y, Paths::pFontRobotoBold,
+      Color::Red, 90, g_over_str);
 
   // create "all ball lost" text
   std::string all_lost_str { "( all balls have been lost )" };
   const float all_lost_x = screen_width_ / 2.0f;
   const float all_lost_y = g_over_y + 70.0f;
-  TextElement all_lost { all_lost_x, all_lost_y, Paths::pFontRobotoRegular,
-    Color::Red, 30, renderer_->GetSDLrenderer(), all_lost_str };
+  game_over_screen_.AddText(all_lost_x, all_lost_y, Paths::pFontRobotoRegular,
+      Color::Red, 30, all_lost_str);
 
   // create total score counter display
-  std::string score_str { std::to_string(total_points_) };
   const float score_x = screen_width_ / 2.0f;
   const float score_y = screen_height_ / 2.0f - 50.f;
-  TextElement score { score_x, score_y, Paths::pFontRobotoBold, Color::Green,
-    120, renderer_->GetSDLrenderer(), score_str };
+  over_score_ = game_over_screen_.AddValue(
+      score_x, score_y, Paths::pFontRobotoBold, Color::Green, 120);
 
   // create "total score" text
   std::string score_txt_str { "T O T A L   S C O R E" };
   const float score_txt_x = screen_width_ / 2.0f;
   const float score_txt_y = score_y + 100;
-  TextElement score_txt { score_txt_x, score_txt_y, Paths::pFontRobotoBold,
-    Color::Green, 36, renderer_->GetSDLrenderer(), score_txt_str };
+  game_over_screen_.AddText(score_txt_x, score_txt_y, Paths::pFontRobotoBold,
+      Color::Green, 36, score_txt_str);
 
   // create offer of restarting the game text
   std::string restart_str {
@@ -610,63 +780,46 @@ void Game::DisplayGameOverScreen() const
   };
   const float restart_x = screen_width_ / 2.0f;
   const float restart_y = screen_height_ * 2.5f / 3.0f;
-  TextElement restart { restart_x, restart_y, Paths::pFontRobotoBold,
-    Color::Orange, 45, renderer_->GetSDLrenderer(), restart_str };
+  game_over_screen_.AddText(restart_x, restart_y, Paths::pFontRobotoBold,
+      Color::Orange, 45, restart_str);
 
   // create offer for quiting text
   std::string quit_str { "Press    ' E S C A P E '    to    quit" };
   const float quit_x = restart_x - 10.0f;
   const float quit_y = restart_y + 80.0f;
-  TextElement quit { quit_x, quit_y, Paths::pFontRobotoBold, Color::Blue, 45,
-    renderer_->GetSDLrenderer(), quit_str };
-
-  // add text elements to the container
-  texts.emplace_back(&g_over);
-  texts.emplace_back(&all_lost);
-  texts.emplace_back(&score);
-  texts.emplace_back(&score_txt);
-  texts.emplace_back(&restart);
-  texts.emplace_back(&quit);
-
-  // Display all text on screen
-  renderer_->DisplayScreen(texts);
+  game_over_screen_.AddText(
+      quit_x, quit_y, Paths::pFontRobotoBold, Color::Blue, 45, quit_str);
 }
 
-// Displays the screen when the game is won
-void Game::DisplayGameWonScreen() const
+// builds the screen displayed when the game is won
+void Game::CreateGameWonScreen()
 {
-  // create container of static objects to be displayed
-  std::vector<const StaticObject*> texts;
-  // reserve container space for all predicted elements
-  texts.reserve(texts_.size() + 6);
-
   // create "game won" text
   std::string won_str { "Y O U    W O N  ! ! !" };
   const float won_x = screen_width_ / 2.0f;
   const float won_y = screen_height_ / 3.0f;
-  TextElement won { won_x, won_y, Paths::pFontRobotoBold, Color::Green, 90,
-    renderer_->GetSDLrenderer(), won_str };
+  game_won_screen_.AddText(
+      won_x, won_y, Paths::pFontRobotoBold, Color::Green, 90, won_str);
 
   // create "Congratulations" text
   std::string congrats_str { "C O N G R A T U L A T I O N S ! ! !" };
   const float congrats_x = screen_width_ / 2.0f;
   const float congrats_y = screen_height_ / 6.5f;
-  TextElement congrats { congrats_x, congrats_y, Paths::pFontRobotoRegular,
-    Color::Green, 50, renderer_->GetSDLrenderer(), congrats_str };
+  game_won_screen_.AddText(congrats_x, congrats_y, Paths::pFontRobotoRegular,
+      Color::Green, 50, congrats_str);
 
   // create total score counter display
-  std::string score_str { std::to_string(total_points_) };
   const float score_x = screen_width_ / 2.0f;
   const float score_y = screen_height_ / 2.0f;
-  TextElement score { score_x, score_y, Paths::pFontRobotoBold, Color::Yellow,
-    120, renderer_->GetSDLrenderer(), score_str };
+  won_score_ = game_won_screen_.AddValue(
+      score_x, score_y, Paths::pFontRobotoBold, Color::Yellow, 120);
 
   // create "total score" text
   std::string score_txt_str { "T O T A L   S C O R E" };
   const float score_txt_x = screen_width_ / 2.0f;
   const float score_txt_y = score_y + 100;
-  TextElement score_txt { score_txt_x, score_txt_y, Paths::pFontRobotoBold,
-    Color::Yellow, 36, renderer_->GetSDLrenderer(), score_txt_str };
+  game_won_screen_.AddText(score_txt_x, score_txt_y, Paths::pFontRobotoBold,
+      Color::Yellow, 36, score_txt_str);
 
   // create offer of restarting the game text
   std::string restart_str {
@@ -674,219 +827,129 @@ void Game::DisplayGameWonScreen() const
   };
   const float restart_x = screen_width_ / 2.0f;
   const float restart_y = screen_height_ * 2.5f / 3.0f;
-  TextElement restart { restart_x, restart_y, Paths::pFontRobotoBold,
-    Color::Orange, 40, renderer_->GetSDLrenderer(), restart_str };
+  game_won_screen_.AddText(restart_x, restart_y, Paths::pFontRobotoBold,
+      Color::Orange, 40, restart_str);
 
   // create offer for quiting text
   std::string quit_str { "Press    ' E S C A P E '    to    quit" };
   const float quit_x = restart_x - 10.0f;
   const float quit_y = restart_y + 80.0f;
-  TextElement quit { quit_x, quit_y, Paths::pFontRobotoBold, Color::Blue, 45,
-    renderer_->GetSDLrenderer(), quit_str };
-
-  // add text elements to the container
-  texts.emplace_back(&won);
-  texts.emplace_back(&congrats);
-  texts.emplace_back(&score);
-  texts.emplace_back(&score_txt);
-  texts.emplace_back(&restart);
-  texts.emplace_back(&quit);
-
-  // Display all text on screen
-  renderer_->DisplayScreen(texts);
+  game_won_screen_.AddText(
+      quit_x, quit_y, Paths::pFontRobotoBold, Color::Blue, 45, quit_str);
 }
 
-// gets a single texture from the stored textures
-const Texture& Game::GetTexture(Sprite sprite) const
+// Displays the game screen (or the info screen halting the game) with the
+// positions of the movable objects interpolated at the given alpha
+void Game::DisplayGameScreen(const FrameSnapshot& snapshot, float alpha)
 {
-  // try to find a stored texture of the given spirte type
-  auto search = images_.find(sprite);
-
-  // If texture wasn't found, THROW exception
-  // (by this point the project design assumes that all requried textures
-  // should be loaded created during game initialization)
-  if (search == images_.end()) {
-    throw std::runtime_error(
-        "Unable to get texture for sprite in function Game::GetTexture()");
+  switch (snapshot.interlude) {
+    case Interlude::BallLost:
+      DisplayBallLostScreen(snapshot);
+      break;
+    case Interlude::LevelCompleted:
+      DisplayLevelCompleted(snapshot);
+      break;
+    case Interlude::None:
+      hud_->Draw(draw_list_, snapshot);
+      arena_view_->Draw(draw_list_, snapshot, alpha);
+      renderer_->DisplayScreen(draw_list_);
+      break;
   }
-  // return found texture
-  return search->second;
 }
 
-// creates the wall limiting the game area
-void Game::CreateWalls()
+// Displays the pause screen when the game is paused
+void Game::DisplayPauseScreen(const FrameSnapshot& snapshot)
 {
-  // design predicts 3 walls so reserve enough space
-  side_walls_.reserve(3);
-
-  CreateTopWall();
-  CreateLeftWall();
-  CreateRightWall();
-
-  // add walls to the displayed objects
-  for (auto& wall : side_walls_) {
-    static_for_game_screen_.emplace_back(&wall);
-  };
+  pause_screen_.SetValue(pause_balls_, snapshot.balls_remaining);
+  pause_screen_.SetValue(pause_level_, snapshot.level);
+  pause_screen_.SetValue(pause_score_, snapshot.total_points);
+  pause_screen_.Draw(draw_list_);
+  renderer_->DisplayScreen(draw_list_);
 }
 
-// creates the top wall
-void Game::CreateTopWall()
+// Displays the screen after ball leaving the screen
+void Game::DisplayBallLostScreen(const FrameSnapshot& snapshot)
 {
-  // get texture for top wall
-  const Texture& texture { GetTexture(Sprite::WallHorizontal) };
-  // calculate positon of the top wall
-  float top_x { screen_width_ / 2.0f };
-  float top_y { texture.Height() / 2.0f };
-  // create top Wall
-  side_walls_.emplace_back(
-      top_x, top_y, ScreenSide::Top, texture, texture.Height() / 2.0f);
+  ball_lost_screen_.SetValue(lost_balls_, snapshot.balls_remaining);
+  ball_lost_screen_.Draw(draw_list_);
+  renderer_->DisplayScreen(draw_list_);
 }
 
-// creates the left wall
-void Game::CreateLeftWall()
+// Displays the screen after the level has been completed
+void Game::DisplayLevelCompleted(const FrameSnapshot& snapshot)
 {
-  //  get texture for the left wall
-  const Texture& texture { GetTexture(Sprite::WallVertical) };
-  // calculate positon of the left wall
-  float left_x { texture.Width() / 2.0f };
-  float left_y { screen_height_ / 2.0f };
-  // create left Wall
-  side_walls_.emplace_back(
-      left_x, left_y, ScreenSide::Left, texture, texture.Width() / 2.0f);
+  // need to decrease level number by one, because after loading
+  // a new level by now the counter is already set to new level
+  level_completed_screen_.SetValue(completed_level_, snapshot.level - 1);
+  level_completed_screen_.SetValue(completed_score_, snapshot.total_points);
+  level_completed_screen_.Draw(draw_list_);
+  renderer_->DisplayScreen(draw_list_);
 }
 
-// creates the right wall
-void Game::CreateRightWall()
-{ //  get texture for the right wall
-  const Texture& texture { GetTexture(Sprite::WallVertical) };
-  // calculate positon of the right wall
-  float right_x { screen_width_ - texture.Width() / 2.0f };
-  float right_y { screen_height_ / 2.0f };
-  // create the right Wall
-  side_walls_.emplace_back(
-      right_x, right_y, ScreenSide::Right, texture, texture.Width() / 2.0f);
+// Displays the screen after all lives/balls have been lost
+void Game::DisplayGameOverScreen(const FrameSnapshot& snapshot)
+{
+  game_over_screen_.SetValue(over_score_, snapshot.total_points);
+  game_over_screen_.Draw(draw_list_);
+  renderer_->DisplayScreen(draw_list_);
 }
 
-// creates the ball
-void Game::CreateBall()
+// Displays the screen when the game is won
+void Game::DisplayGameWonScreen(const FrameSnapshot& snapshot)
 {
-  ball_ = std::make_unique<Ball>(level_data_->BallSpeed(),
-      GetTexture(Sprite::Ball), *paddle_, screen_height_, *this, side_walls_,
-      blocks_);
-
-  // verify if ball created successfully. If not throw exception
-  if (!ball_) {
-    throw std::runtime_error("Unable to create the ball");
-  }
-
-  // Add ball to the collection of movable objects to be displayed
-  movable_for_game_screen_.emplace_back(ball_.get());
-}
-
-// creates the paddle
-void Game::CreatePaddle()
-{
-  // get paddle texture and calculate vertical position
-  auto& paddle_texture { GetTexture(Sprite::Paddle) };
-  float paddle_y = screen_height_ - paddle_texture.Height() / 2.0f;
-  // calculate and create rectangle limiting the paddle move range
-  int wall_tickness { GetTexture(Sprite::WallVertical).Width() };
-  SDL_Rect limits;
-  // set top-left coordinates of the limiting rectangle
-  limits.x = wall_tickness;
-  limits.y = screen_height_ * 4 / 5;
-  // set width of the limiting rectangle
-  limits.w = screen_width_ - 2 * wall_tickness;
-  // set height of the limiting rectangle
-  limits.h = screen_height_ - limits.y;
-
-  // create the actuall paddle and set unique pointer
-  paddle_ = std::make_unique<Paddle>(screen_width_ / 2.0f, paddle_y,
-      level_data_->PaddleSpeed(), limits, paddle_texture);
-  // verify if paddle created successfully. If not throw exception
-  if (!paddle_) {
-    throw std::runtime_error("Unable to create the paddle");
-  }
-
-  // add paddle to the collection of objects to be displayed
-  movable_for_game_screen_.emplace_back(paddle_.get());
-}
-
-// creates blocks
-void Game::CreateBlocks()
-{
-  // reserve space in the container for blocks
-  blocks_.reserve(LevelData::max_rows * LevelData::row_size);
-
-  // aquire the sprite table representing block layout
-  auto& sprite_table = level_data_->SpriteTable();
-  // position offset of each block
-  const float wall_offset { static_cast<float>(
-      GetTexture(Sprite::WallVertical).Width()) };
-  // horizontal position offset of each concecutive block from the other
-  const float block_width { LevelData::block_width };
-  // vertical position offset of each consecutive block from the other
-  const float block_height { LevelData::block_height };
-  // point value assigned to block on current game level
-  const unsigned point_value { level_data_->PointsPerBlock() };
-  // temporary helper variables to be calculated on most loop passes
-  float block_x {};
-  float block_y {};
-  // parse each row of the spirte_table
-  for (std::size_t row = 0; row < sprite_table.size(); row++) {
-    // parse each column of the row
-    for (std::size_t col = 0; col < sprite_table[row].size(); col++) {
-      // construct only those blocks, for which there is a sprite set in the
-      // sprite table
-      if (sprite_table[row][col] != Sprite::None) {
-        block_x = (block_width * col) + wall_offset + (block_width / 2.0f) - 1;
-        block_y = (block_height * row) + wall_offset + (block_height / 2.0f);
-        auto& texture { GetTexture(sprite_table[row][col]) };
-        blocks_.emplace_back(block_x, block_y, texture, point_value);
-      }
-    }
-  }
-  // add blocks to the collection of static objects to be displayed
-  for (auto& block : blocks_) {
-    static_for_game_screen_.emplace_back(&block);
-  }
+  game_won_screen_.SetValue(won_score_, snapshot.total_points);
+  game_won_screen_.Draw(draw_list_);
+  renderer_->DisplayScreen(draw_list_);
 }
 
-// handles the ball leaving the allowed screen area
-void Game::HandleBallEscape()
+// describes the game area and its objects using the sizes of the loaded
+// sprites
+ArenaLayout Game::CreateLayout() const
 {
-  PlaySound(Sound::BallLost);
-
-  // decrease number of balls available
-  balls_remaining_--;
-
-  // check if the player run out of lives/balls
-  if (balls_remaining_ <= 0) {
-    // the game is over
-    state_ = GameState::Over;
-  }
-  // player still has lives/balls left
-  else {
-    DisplayBallLostScreen();
-
-    // halt execution for a couple of seconds
-    SDL_Delay(4000);
-
-    // reset the ball passing the level starting speed
-    // to get the ball back on the paddle and cancelling
-    // all speed increases applied by the player
-    ball_->Reset(level_data_->BallSpeed());
-  }
+  ArenaLayout layout;
+  layout.width = static_cast<float>(screen_width_);
+  layout.height = static_cast<float>(screen_height_);
+  layout.wall_tickness
+      = static_cast<float>(atlas_->Region(Sprite::WallVertical).w);
+  layout.paddle_width = static_cast<float>(atlas_->Region(Sprite::Paddle).w);
+  layout.paddle_height
+      = static_cast<float>(atlas_->Region(Sprite::Paddle).h);
+  layout.ball_radius = atlas_->Region(Sprite::Ball).w / 2.0f;
+  return layout;
 }
 
-// handles a block being hit by the ball
-void Game::HandleBlockHit(Block& block)
+// reacts to the events happening in the arena (sounds and info screens); called
+// on the simulation thread
+void Game::OnEvent(const EventRecord& event)
 {
-  PlaySound(Sound::BlockHit);
-
-  // mark block as destroyed to skip further rendering and collision checks
-  block.MarkDestroyed();
-
-  // increase points score with point value assigned to the block
-  total_points_ += block.Points();
-}
\ No newline at end of file
+  // all the occurrences within a frame are sounded once
+  switch (event.type) {
+    case GameEvent::WallBounce:
+      PlaySound(Sound::BallBounceWall);
+      break;
+    // the ball starting from the paddle sounds like bouncing off it
+    case GameEvent::BallStarted:
+    case GameEvent::PaddleHit:
+      PlaySound(Sound::BallPaddleHit);
+      break;
+    case GameEvent::BlockDestroyed:
+      PlaySound(Sound::BlockHit);
+      break;
+    case GameEvent::BallLost:
+      PlaySound(Sound::BallLost);
+      // check if the player run out of lives/balls
+      if (arena_->IsLost()) {
+        // the game is over
+        state_ = GameState::Over;
+      }
+      // player still has lives/balls left; halt the game for a couple of
+      // seconds
+      else {
+        StartInterlude(Interlude::BallLost);
+      }
+      break;
+    // the next level is loaded by RunSimulationSteps()
+    case GameEvent::LevelCleared:
+      break;
+  }
+}
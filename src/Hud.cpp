@@ -0,0 +1,79 @@
+#include "Hud.hpp"
+#include "Colors.hpp"
+#include "Paths.hpp"
+#include <array>
+#include <charconv>
+
+namespace {
+// labels of the counters
+constexpr std::string_view level_label { "LEVEL  " };
+constexpr std::string_view score_label { "SCORE  " };
+constexpr std::string_view balls_label { "BALLS  " };
+
+// buffer for the decimal digits of an unsigned counter
+using DigitBuffer = std::array<char, 16>;
+
+// writes the decimal digits of the value into the buffer and returns them
+std::string_view FormatValue(unsigned value, DigitBuffer& buffer)
+{
+  const auto result
+      = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  return std::string_view(
+      buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+}
+}
+
+// Constructor. Takes the text engine used for drawing, the width of the screen
+// and the vertical position of the HUD. May throw SDLexception if opening the
+// font or rendering its glyphs fails
+Hud::Hud(TextEngine& textEngine, float screenWidth, float y)
+    : text_engine_(textEngine)
+    , font_(textEngine.Font(Paths::pFontRobotoBold, 24))
+    , screen_width_(screenWidth)
+    // the texts are placed by their centres
+    , top_(static_cast<int>(y) - textEngine.Measure(font_, level_label).y / 2)
+    // measuring renders the characters of the labels too
+    , level_label_width_(textEngine.Measure(font_, level_label).x)
+    , score_label_width_(textEngine.Measure(font_, score_label).x)
+    , balls_label_width_(textEngine.Measure(font_, balls_label).x)
+{
+  // render all the digits which may ever be displayed
+  text_engine_.Preload(font_, "0123456789");
+}
+
+// adds the commands displaying the counters of the snapshot to the draw list
+void Hud::Draw(DrawList& drawList, const FrameSnapshot& snapshot) const
+{
+  DigitBuffer level_digits;
+  DigitBuffer score_digits;
+  DigitBuffer balls_digits;
+  const std::string_view level = FormatValue(snapshot.level, level_digits);
+  const std::string_view score
+      = FormatValue(snapshot.total_points, score_digits);
+  const std::string_view balls
+      = FormatValue(snapshot.balls_remaining, balls_digits);
+
+  // the level on the left, the score centred and the balls on the right;
+  // only the positions of the latter two depend on the widths of the values
+  const int score_width
+      = score_label_width_ + text_engine_.Measure(font_, score).x;
+  const int balls_width
+      = balls_label_width_ + text_engine_.Measure(font_, balls).x;
+  DrawCounter(drawList, level_label, level_label_width_, level, Color::Blue,
+      static_cast<int>(margin));
+  DrawCounter(drawList, score_label, score_label_width_, score, Color::Green,
+      static_cast<int>(screen_width_ - score_width) / 2);
+  DrawCounter(drawList, balls_label, balls_label_width_, balls, Color::Yellow,
+      static_cast<int>(screen_width_ - margin) - balls_width);
+}
+
+// adds the commands displaying the label (of the given width) followed by the
+// value, starting at the given x coordinate, to the draw list
+void Hud::DrawCounter(DrawList& drawList, std::string_view label,
+    int labelWidth, std::string_view value, SDL_Color color, int left) const
+{
+  text_engine_.DrawAt(
+      drawList, DrawLayer::Hud, font_, label, color, left, top_);
+  text_engine_.DrawAt(drawList, DrawLayer::Hud, font_, value, color,
+      left + labelWidth, top_);
+}
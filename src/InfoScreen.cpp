@@ -0,0 +1,54 @@
+#include "InfoScreen.hpp"
+
+// Constructor. Takes the text engine used by all the texts of the screen
+InfoScreen::InfoScreen(TextEngine& textEngine)
+    : text_engine_(textEngine)
+{
+}
+
+// adds a text which never changes and returns it (e.g. for further layout).
+// Takes: x,y coordinates of the text on the screen, path of the font file,
+// color of text, size of text (pixels) and the text itself.
+// May throw SDLexception if opening the font or rendering its glyphs fails
+const TextElement& InfoScreen::AddText(float x, float y,
+    const std::string& fontPath, SDL_Color color, int textSize,
+    const std::string& text)
+{
+  texts_.emplace_back(x, y, fontPath, color, textSize, text_engine_, text);
+  return texts_.back();
+}
+
+// Adds a text displaying a value preceded by the prefix (e.g. "LEVEL ") and
+// returns its identifier. The value is displayed after the first call of
+// SetValue(). Takes the same arguments as AddText(), except the text.
+// May throw SDLexception if opening the font fails
+InfoScreen::ValueId InfoScreen::AddValue(float x, float y,
+    const std::string& fontPath, SDL_Color color, int textSize,
+    const std::string& prefix)
+{
+  texts_.emplace_back(x, y, fontPath, color, textSize, text_engine_, "");
+  values_.push_back(BoundValue { &texts_.back(), prefix, 0, false });
+  return values_.size() - 1;
+}
+
+// Sets the value of the bound text, updating the text only if the value
+// differs from the displayed one. May throw SDLexception if rendering glyphs
+// fails
+void InfoScreen::SetValue(ValueId id, unsigned value)
+{
+  BoundValue& bound = values_.at(id);
+  if (bound.is_set && bound.value == value) {
+    return;
+  }
+  bound.text->SetText(bound.prefix + std::to_string(value));
+  bound.value = value;
+  bound.is_set = true;
+}
+
+// adds the commands displaying all the texts of the screen to the draw list
+void InfoScreen::Draw(DrawList& drawList) const
+{
+  for (const auto& text : texts_) {
+    text.Draw(drawList);
+  }
+}
@@ -2,8 +2,9 @@
 
 // constructor
 IntervalTimer::IntervalTimer()
-    : previous_time_(SDL_GetTicks())
+    : previous_time_(Clock::now())
     , current_time_(previous_time_)
+    , paused_(false)
 {
 }
 
@@ -15,15 +16,15 @@ float IntervalTimer::UpdateAndGetInterval()
   // and reset the timer
   if (paused_) {
     paused_ = false;
-    current_time_ = previous_time_ = SDL_GetTicks();
+    current_time_ = previous_time_ = Clock::now();
   }
 
-  // get current clock ticks
-  current_time_ = SDL_GetTicks();
-  // count the ticks difference from previous measurement
-  Uint32 interval = current_time_ - previous_time_;
+  // get current clock time
+  current_time_ = Clock::now();
+  // count the time difference from previous measurement
+  const std::chrono::duration<float> interval = current_time_ - previous_time_;
   // start new "lap"
   previous_time_ = current_time_;
-  // convert the clock ticks and return seconds
-  return static_cast<float>(interval) / ticks_per_second;
-}
\ No newline at end of file
+  // return the interval in seconds
+  return interval.count();
+}
@@ -1,11 +1,28 @@
 #include "LevelData.hpp"
 #include <exception>
+#include <iterator>
 #include <sstream>
+#include <streambuf>
 #include <string>
 
 // for operator""s usage
 using namespace std::string_literals;
 
+namespace {
+// read-only stream buffer over characters in memory, so the level text can be
+// parsed with streams without copying it
+class TextBuffer : public std::streambuf
+{
+  public:
+  explicit TextBuffer(std::string_view text)
+  {
+    // the characters are only read, never written through the buffer
+    char* begin = const_cast<char*>(text.data());
+    setg(begin, begin, begin + text.size());
+  }
+};
+}
+
 // Static members initialization:
 
 // the keyword marking the ball speed in the level file
@@ -17,9 +34,12 @@ const std::string LevelData::lives_key { "lives" };
 // the keyword marking the points per block destroyed in the parsed level file
 const std::string LevelData::points_per_block_key { "points_per_block" };
 
-// constructor taking the path to levels to load and level number
-// throws std::runtime_error if unable to load level data
-LevelData::LevelData(const std::string& path, unsigned levelNumber)
+// Constructor taking the path to levels to load, level number and the asset
+// pack to read the level file from (if the pack contains it; the file is read
+// from the disk otherwise).
+// Throws std::runtime_error if unable to load level data
+LevelData::LevelData(
+    const std::string& path, unsigned levelNumber, const AssetPack* assets)
     : level_(levelNumber)
     , ball_speed_(0.0f)
     , paddle_speed_(0.0f)
@@ -30,9 +50,28 @@ LevelData::LevelData(const std::string& path, unsigned levelNumber)
   std::string full_path
       = path + "Level_" + std::to_string(levelNumber) + ".txt";
 
+  // the whole file is read once: viewed in the mapped pack or loaded from the
+  // disk
+  std::string file_contents;
+  std::string_view level_text;
+  if (const AssetEntry* entry = assets ? assets->Find(full_path) : nullptr) {
+    level_text = entry->data;
+  }
+  else {
+    std::ifstream file_stream(full_path);
+    // check if opening file for reading was successful
+    if (!file_stream) {
+      throw std::runtime_error(
+          "Unable to open file with the level data!"s + full_path);
+    }
+    file_contents.assign(std::istreambuf_iterator<char>(file_stream),
+        std::istreambuf_iterator<char>());
+    level_text = file_contents;
+  }
+
   // read level numerical data and the sprite table representing block
   // composition or throw exception if unsuccessful
-  if (!ReadNumericalData(full_path) || !ReadSpriteTable(full_path)) {
+  if (!ReadNumericalData(level_text) || !ReadSpriteTable(level_text)) {
     throw std::runtime_error(
         "Error: wrong format in level file: "s + full_path);
   }
@@ -45,12 +84,11 @@ const std::vector<std::vector<Sprite>>& LevelData::SpriteTable() const
   return sprite_table_;
 }
 
-// Reads and returns single value described by key from the file.
+// Reads and returns single value described by key from the level text.
 // If the value wasn't found returns default value for the type.
-// Throws std::runtime_error if was unable to open file
 template <typename T>
 T LevelData::ReadDataItem(
-    const std::string& filePath, const std::string& keyword) const
+    std::string_view levelText, const std::string& keyword) const
 {
   // single word read and checked against keyword for match
   std::string word;
@@ -58,13 +96,9 @@ T LevelData::ReadDataItem(
   std::string line;
   // returned value
   T value {};
-  // open file for reading
-  std::ifstream file_stream(filePath);
-  // check if opening file for reading was successful
-  if (!file_stream) {
-    throw std::runtime_error(
-        "Unable to open file with the level data!"s + filePath);
-  }
+  // stream over the level text
+  TextBuffer buffer { levelText };
+  std::istream file_stream { &buffer };
 
   // read entire file line by line
   while (std::getline(file_stream, line)) {
@@ -82,14 +116,14 @@ T LevelData::ReadDataItem(
   return T {};
 }
 
-// reads all level numerical data from the level file
+// reads all level numerical data from the level text
 // returns true if succesfull, false - otherwise
-bool LevelData::ReadNumericalData(const std::string& filePath)
+bool LevelData::ReadNumericalData(std::string_view levelText)
 {
-  ball_speed_ = ReadDataItem<float>(filePath, ball_speed_key);
-  paddle_speed_ = ReadDataItem<float>(filePath, paddle_speed_key);
-  lives_ = ReadDataItem<unsigned>(filePath, lives_key);
-  points_per_block_ = ReadDataItem<unsigned>(filePath, points_per_block_key);
+  ball_speed_ = ReadDataItem<float>(levelText, ball_speed_key);
+  paddle_speed_ = ReadDataItem<float>(levelText, paddle_speed_key);
+  lives_ = ReadDataItem<unsigned>(levelText, lives_key);
+  points_per_block_ = ReadDataItem<unsigned>(levelText, points_per_block_key);
   // check if the read values make sense
   if (ball_speed_ <= 0.0 || paddle_speed_ <= 0.0 || lives_ == 0 || lives_ > 5
       || points_per_block_ == 0) {
@@ -100,21 +134,16 @@ bool LevelData::ReadNumericalData(const std::string& filePath)
   return true;
 }
 
-// Parses the given file and tries to create and fill member sprite table,
-// where each object of enum type Sprite corresponds to one block. In the file
-// however, each block is represented by single character, so the function
+// Parses the given level text and tries to create and fill member sprite
+// table, where each object of enum type Sprite corresponds to one block. In the
+// file however, each block is represented by single character, so the function
 // maps the char into Sprite while reading. returns true if sprite table is
 // created succesfully, false otherwise
-// Throws std::runtime_error if was unable to open file
-bool LevelData::ReadSpriteTable(const std::string& filePath)
+bool LevelData::ReadSpriteTable(std::string_view levelText)
 {
-  // open the file
-  std::ifstream file_stream(filePath);
-  // check if opening file for reading was successful
-  if (!file_stream) {
-    throw std::runtime_error(
-        "Unable to open file with the level data!"s + filePath);
-  }
+  // stream over the level text
+  TextBuffer buffer { levelText };
+  std::istream file_stream { &buffer };
 
   // single line of file data to be read
   std::string file_line;
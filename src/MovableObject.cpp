@@ -3,6 +3,7 @@
 // default constructor;
 MovableObject::MovableObject()
     : position_(gMath::Vector2d())
+    , previous_position_(position_)
     , _speed(0.0f)
 {
 }
@@ -10,12 +11,15 @@ MovableObject::MovableObject()
 // sets position_ vector and sclar speed
 MovableObject::MovableObject(float x, float y, float speed)
     : position_(gMath::Vector2d(x, y))
+    , previous_position_(position_)
     , _speed(speed)
 {
 }
 
-// sets object position
+// sets object position; the object is moved there at once, so it is not
+// interpolated from its previous position
 void MovableObject::SetPosition(float x, float y)
 {
   position_ = gMath::Vector2d(x, y);
+  previous_position_ = position_;
 }
\ No newline at end of file
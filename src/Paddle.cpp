@@ -1,24 +1,26 @@
 #include "Paddle.hpp"
+#include <stdexcept>
 
 // Constructor:
 // X, Y - paddle centre coordinates
-// speed - ball scalar speed in pixels / second
+// speed - paddle scalar speed in pixels / second
 // moveLimits - invisible rectangle within the paddle can move
-// texture - texture used for displaying the ball.
+// halfWidth, halfHeight - half of the paddle size
 // Throws std::invalid_argument if passed values don't allow to create the
 // Paddle
-Paddle::Paddle(
-    float x, float y, float speed, SDL_Rect moveLimits, const Texture& texture)
+Paddle::Paddle(float x, float y, float speed, gMath::Rect moveLimits,
+    float halfWidth, float halfHeight)
     : MovableObject(x, y, speed)
     , velocity_(gMath::Vector2d())
     , move_limits_(moveLimits)
-    , texture_(texture)
-    , half_height_(texture_.Height() / 2.0f)
-    , half_width_(texture_.Width() / 2.0f)
+    , half_height_(halfHeight)
+    , half_width_(halfWidth)
 {
   // check if the passed arguments allow to construct the paddle with reasonable
   // values. Throw exception if not, as continuation makes no sense.
-  if (x < moveLimits.x || y < moveLimits.y || speed < 0.0f)
+  if (x < moveLimits.x || y < moveLimits.y || speed < 0.0f
+      || half_width_ <= 0.0f || half_height_ <= 0.0f
+      || moveLimits.w < 2 * half_width_ || moveLimits.h < 2 * half_height_)
     throw std::invalid_argument(
         "Invalid arguments passed to the Paddle constructor");
 }
@@ -32,13 +34,6 @@ void Paddle::Update(float deltaTime)
   KeepInMovingLimits();
 };
 
-// render the paddle
-void Paddle::Draw() const
-{
-  texture_.Render(
-      static_cast<int>(position_.X()), static_cast<int>(position_.Y()));
-}
-
 // stops the paddle by setting velocity vector to {0,0}
 void Paddle::Stop()
 {
@@ -77,24 +72,13 @@ void Paddle::MoveRight()
 // corrects position if paddle tries to escape allowed moving area
 void Paddle::KeepInMovingLimits()
 {
-  // move right if reached the left limit
-  if (position_.X() - half_width_ < move_limits_.x) {
-    position_.SetX(move_limits_.x + half_width_ + 1);
-    return;
-  }
-  // move left if reached the right limit
-  if (position_.X() + half_width_ > move_limits_.x + move_limits_.w) {
-    position_.SetX(move_limits_.x + move_limits_.w - half_width_ - 1);
-    return;
-  }
-  // move down if reached the the top limit
-  if (position_.Y() - half_height_ < move_limits_.y) {
-    position_.SetY(move_limits_.y + half_height_ + 1);
-    return;
-  }
-  // move up if reached the bottom limit
-  if (position_.Y() + half_height_ > move_limits_.y + move_limits_.h) {
-    position_.SetY(move_limits_.y + move_limits_.h - half_height_ - 1);
-    return;
-  }
+  // the paddle centre must stay far enough from the limits for the whole
+  // paddle to fit within them
+  const gMath::Vector2d min_position { move_limits_.x + half_width_,
+    move_limits_.y + half_height_ };
+  const gMath::Vector2d max_position {
+    move_limits_.x + move_limits_.w - half_width_,
+    move_limits_.y + move_limits_.h - half_height_
+  };
+  position_ = gMath::Clamp(position_, min_position, max_position);
 }
\ No newline at end of file
@@ -4,10 +4,21 @@
 // calculations
 namespace gMath {
 
-// define static random device for seeding random engine
-std::random_device RandNum::device;
+// Constructor. Takes the seed determining the whole stream of numbers
+RandNum::RandNum(std::uint64_t seed)
+{
+  // The state is filled with the SplitMix64 sequence started from the seed,
+  // which turns similar seeds (like consecutive numbers) into unrelated
+  // states (the forbidden all-zero state is practically impossible)
+  for (int i = 0; i < 4; i += 2) {
+    seed += 0x9E3779B97F4A7C15ull;
+    std::uint64_t mixed = seed;
+    mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBull;
+    mixed ^= mixed >> 31;
+    state_[i] = static_cast<std::uint32_t>(mixed);
+    state_[i + 1] = static_cast<std::uint32_t>(mixed >> 32);
+  }
+}
 
-// define mersenne twister engine seeding it with a random device
-std::mt19937 RandNum::engine(device());
-
-} // end of namespace gMath
\ No newline at end of file
+} // end of namespace gMath
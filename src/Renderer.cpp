@@ -1,21 +1,36 @@
 #include "Renderer.hpp"
-#include "LimitTimer.hpp"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
 #include "SDLexception.hpp"
 
-// Constructor. Takes screen size for rendering.
+// Constructor. Takes screen size for rendering and the mode of rendering.
 // Throws std::ivalid_argument if the size is non-positive
 // Throws SDLexception if initializing SDL_Renderer will fail
-Renderer::Renderer(
-    const std::size_t screenHeight, const std::size_t screenWidth)
+Renderer::Renderer(const std::size_t screenHeight,
+    const std::size_t screenWidth, RenderMode mode)
     : screen_height_(screenHeight)
     , screen_width_(screenWidth)
+    , mode_(mode)
     , sdl_window_(nullptr)
+    , surface_(nullptr)
     , sdl_renderer_(nullptr)
 {
   // Check if the screensize passed was correct and report error if not
   if (screen_height_ <= 0 || screen_width_ <= 0)
     throw std::invalid_argument("Cannot create Window with size less than 0!");
 
+  if (mode_ == RenderMode::Offscreen) {
+    CreateOffscreenRenderer();
+  }
+  else {
+    CreateWindowRenderer();
+  }
+}
+
+// creates the window and the hardware renderer presenting to it
+void Renderer::CreateWindowRenderer()
+{
   // create main game window using unique pointer with custom deleter,
   // which will automatically destroy the window as per RAII
   sdl_window_ = std::unique_ptr<SDL_Window, std::function<void(SDL_Window*)>> {
@@ -35,7 +50,8 @@ Renderer::Renderer(
   sdl_renderer_
       = std::unique_ptr<SDL_Renderer, std::function<void(SDL_Renderer*)>> {
           SDL_CreateRenderer(sdl_window_.get(), -1,
-              SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC),
+              SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
+                  | SDL_RENDERER_TARGETTEXTURE),
           [](SDL_Renderer* ptr) { SDL_DestroyRenderer(ptr); }
         };
 
@@ -46,75 +62,117 @@ Renderer::Renderer(
   }
 }
 
-// displays (renders) game graphics composed of the passed arguments:
-// a vector of static (non-movable) and a vector of movable objects
-void Renderer::DisplayScreen(
-    const std::vector<const StaticObject*>& staticObjects,
-    const std::vector<const MovableObject*>& movableObjects) const
+// creates the surface and the software renderer drawing into it
+void Renderer::CreateOffscreenRenderer()
 {
-  UpdateTitleBar();
+  // the frame is kept in memory in a fixed pixel format, so its hash doesn't
+  // depend on the platform; custom deleter is used due to specific SDL
+  // surface destruction function
+  surface_ = std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface*)>> {
+    SDL_CreateRGBSurfaceWithFormat(0, static_cast<int>(screen_width_),
+        static_cast<int>(screen_height_), 32, SDL_PIXELFORMAT_RGBA32),
+    [](SDL_Surface* ptr) { SDL_FreeSurface(ptr); }
+  };
+  if (!surface_) {
+    throw SDLexception("Could not create offscreen surface", SDL_GetError(),
+        __FILE__, __LINE__);
+  }
+
+  // the software renderer supports render targets and geometry as well, so
+  // the whole rendering path is the same as for the window
+  sdl_renderer_
+      = std::unique_ptr<SDL_Renderer, std::function<void(SDL_Renderer*)>> {
+          SDL_CreateSoftwareRenderer(surface_.get()),
+          [](SDL_Renderer* ptr) { SDL_DestroyRenderer(ptr); }
+        };
+  if (!sdl_renderer_) {
+    throw SDLexception("Could not create offscreen renderer", SDL_GetError(),
+        __FILE__, __LINE__);
+  }
+}
 
+// Displays a screen drawn by the commands of the draw list sent as argument;
+// the list is emptied
+void Renderer::DisplayScreen(DrawList& drawList) const
+{
   // Set clear screen color
   SDL_SetRenderDrawColor(sdl_renderer_.get(), 0x00, 0x00, 0x00, 0xFF);
   // clear screen
   SDL_RenderClear(sdl_renderer_.get());
 
-  // display all static game objects
-  for (auto& object : staticObjects) {
-    object->Draw();
-  }
+  // execute all the draw commands of the screen in the order of layers
+  drawList.Submit(sdl_renderer_.get());
 
-  // display all movable game objects
-  for (auto& object : movableObjects) {
-    object->Draw();
+  // the frame has to be read back before presenting, as the back buffer is
+  // undefined afterwards
+  if (recorder_) {
+    recorder_->Capture(sdl_renderer_.get());
   }
 
-  // update screen
-  SDL_RenderPresent(sdl_renderer_.get());
+  // update screen; the offscreen frame only has to be finished in the
+  // surface
+  if (mode_ == RenderMode::Offscreen) {
+    SDL_RenderFlush(sdl_renderer_.get());
+  }
+  else {
+    SDL_RenderPresent(sdl_renderer_.get());
+  }
 }
 
-// Displays a screen containing static (non-movable) objects sent as argument
-void Renderer::DisplayScreen(
-    const std::vector<const StaticObject*>& staticObjects) const
+// displays the frame rate and frame time statistics in the window title bar
+void Renderer::ShowFrameStats(const FrameStats& stats) const
 {
-  UpdateTitleBar();
-
-  // Set clear screen color
-  SDL_SetRenderDrawColor(sdl_renderer_.get(), 0x00, 0x00, 0x00, 0xFF);
-  // clear screen
-  SDL_RenderClear(sdl_renderer_.get());
-
-  // display all text objects game objects
-  for (auto& object : staticObjects) {
-    object->Draw();
+  // frame rate calculated from the average frame interval
+  const double fps = stats.mean_ms > 0.0 ? 1000.0 / stats.mean_ms : 0.0;
+
+  std::ostringstream title;
+  title << std::fixed << std::setprecision(1)
+        << "Simple Akranoid game! Have fun!\t\t\tFPS: " << fps
+        << std::setprecision(2) << "   frame: " << stats.mean_ms
+        << " ms   jitter: " << stats.jitter_ms
+        << " ms   max: " << stats.max_ms << " ms";
+  if (recorder_) {
+    title << "   recorded: " << recorder_->FramesWritten()
+          << "   dropped: " << recorder_->FramesDropped();
   }
 
-  // update screen
-  SDL_RenderPresent(sdl_renderer_.get());
+  // there is no window title bar offscreen
+  if (mode_ == RenderMode::Offscreen) {
+    std::cout << title.str() << std::endl;
+  }
+  else {
+    SDL_SetWindowTitle(sdl_window_.get(), title.str().c_str());
+  }
 }
 
-// updates game window title bar
-void Renderer::UpdateTitleBar() const
+// Returns the 64-bit FNV-1a hash of the pixels of the last displayed frame, so
+// frames can be compared without storing them. Available only in the offscreen
+// mode; returns 0 otherwise
+std::uint64_t Renderer::FrameHash() const
 {
-  // create timer for window title udpates
-  // the title is to be updated every second (1000 ticks)
-  const Uint32 c_title_update_time = 1000;
-  static LimitTimer title_update_timer { c_title_update_time };
-  // frame count for FPS updating
-  static int frames { 0 };
-
-  // update frame count for FPS calculation
-  frames++;
-  // if 1s has passed, update window title bar
-  if (title_update_timer.hasExpired()) {
-    // create and display title to be updated every second
-    std::string title { "Simple Akranoid game! Have fun!\t\t\tFPS: " };
-    title += std::to_string(frames);
-    SDL_SetWindowTitle(sdl_window_.get(), title.c_str());
-
-    // reset number of frames for another run
-    frames = 0;
-    // restart timer for window title udpates
-    title_update_timer.restart();
+  if (!surface_) {
+    return 0;
+  }
+
+  constexpr std::uint64_t fnv_offset_basis { 0xcbf29ce484222325ull };
+  constexpr std::uint64_t fnv_prime { 0x100000001b3ull };
+
+  SDL_Surface* surface = surface_.get();
+  if (SDL_MUSTLOCK(surface)) {
+    SDL_LockSurface(surface);
+  }
+  // only the visible pixels of the rows count, not the padding up to the
+  // pitch
+  const std::size_t row_size = static_cast<std::size_t>(surface->w) * 4;
+  std::uint64_t hash { fnv_offset_basis };
+  const auto* row = static_cast<const unsigned char*>(surface->pixels);
+  for (int y = 0; y < surface->h; y++, row += surface->pitch) {
+    for (std::size_t i = 0; i < row_size; i++) {
+      hash = (hash ^ row[i]) * fnv_prime;
+    }
+  }
+  if (SDL_MUSTLOCK(surface)) {
+    SDL_UnlockSurface(surface);
   }
+  return hash;
 }
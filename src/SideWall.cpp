@@ -1,18 +1,13 @@
 #include "SideWall.hpp"
 
-// constructor creating the Wall
+// Constructor creating the Wall. Takes x and y coordinates of the wall centre,
+// the side of the screen the wall is placed on, half of the wall tickness and
+// half of the wall length (measured along the screen side)
 SideWall::SideWall(float x, float y, ScreenSide sideOfScreen,
-    const Texture& texture, float HalfTickness)
-    : StaticObject(x, y)
+    float halfTickness, float halfLength)
+    : position_(x, y)
     , screen_side_(sideOfScreen)
-    , texture_(texture)
-    , half_tickness_(HalfTickness)
+    , half_tickness_(halfTickness)
+    , half_length_(halfLength)
 {
 }
-
-// renders the sideWall to the screen
-void SideWall::Draw() const
-{
-  texture_.Render(
-      static_cast<int>(position_.X()), static_cast<int>(position_.Y()));
-}
\ No newline at end of file
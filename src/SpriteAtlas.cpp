@@ -0,0 +1,132 @@
+#include "SpriteAtlas.hpp"
+#include "SDLexception.hpp"
+#include <algorithm>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+
+// for operator""s usage
+using std::string_literals::operator""s;
+
+// pointer for temporary SDL_Surface with custom deleter
+using SurfacePtr = AssetLoader::SurfacePtr;
+
+// Constructor. Takes the sprites with the paths of their image files, the
+// loader reading the images and the renderer for texture creation. Throws
+// SDLexception if loading any of the images or creating the texture fails
+SpriteAtlas::SpriteAtlas(
+    const std::vector<std::pair<Sprite, std::string>>& images,
+    const AssetLoader& assets, SDL_Renderer* gameRenderer)
+    : sdl_texture_(nullptr)
+{
+  if (images.empty()) {
+    throw std::invalid_argument("SpriteAtlas needs at least one image!");
+  }
+  auto free_surface = [](SDL_Surface* ptr) { SDL_FreeSurface(ptr); };
+
+  // Decode all the images at once, each on its own thread, so loading takes
+  // as long as the slowest image instead of all of them together (the images
+  // decoded in advance in the asset pack are only wrapped). Only the texture
+  // is created on the calling (rendering) thread
+  std::vector<std::future<SurfacePtr>> decoded;
+  decoded.reserve(images.size());
+  for (const auto& image : images) {
+    decoded.push_back(std::async(std::launch::async,
+        [&assets, &image] { return assets.LoadImage(image.second); }));
+  }
+  // the first failure is rethrown after all the decoding threads finish
+  std::vector<SurfacePtr> surfaces;
+  surfaces.reserve(images.size());
+  for (auto& image : decoded) {
+    surfaces.push_back(image.get());
+  }
+
+  // Pack the images into shelves (rows) filled from left to right, starting
+  // with the tallest images. The atlas is as wide as the widest image (the
+  // walls span the whole screen), but not narrower than 1024 pixels
+  std::vector<std::size_t> order(images.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+    return surfaces[lhs]->h > surfaces[rhs]->h;
+  });
+  width_ = 1024;
+  for (const auto& surface : surfaces) {
+    width_ = std::max(width_, surface->w + 2 * padding);
+  }
+
+  std::vector<SDL_Rect> placed(images.size());
+  int shelf_x { 0 };
+  int shelf_y { 0 };
+  int shelf_height { 0 };
+  for (std::size_t i : order) {
+    const int w = surfaces[i]->w + 2 * padding;
+    const int h = surfaces[i]->h + 2 * padding;
+    // start a new shelf if the image doesn't fit into the current one
+    if (shelf_x + w > width_) {
+      shelf_y += shelf_height;
+      shelf_x = 0;
+      shelf_height = 0;
+    }
+    placed[i] = SDL_Rect { shelf_x + padding, shelf_y + padding,
+      surfaces[i]->w, surfaces[i]->h };
+    shelf_x += w;
+    shelf_height = std::max(shelf_height, h);
+  }
+  height_ = shelf_y + shelf_height;
+
+  // copy the images into their regions of a transparent surface
+  SurfacePtr atlas { SDL_CreateRGBSurfaceWithFormat(
+                         0, width_, height_, 32, SDL_PIXELFORMAT_RGBA32),
+    free_surface };
+  if (!atlas) {
+    throw SDLexception { "Unable to create the sprite atlas surface",
+      SDL_GetError(), __FILE__, __LINE__ };
+  }
+  for (std::size_t i = 0; i < images.size(); i++) {
+    // copy the pixels including alpha instead of blending them
+    SDL_SetSurfaceBlendMode(surfaces[i].get(), SDL_BLENDMODE_NONE);
+    SDL_Rect destination = placed[i];
+    if (SDL_BlitSurface(surfaces[i].get(), nullptr, atlas.get(), &destination)
+        != 0) {
+      throw SDLexception { "Unable to copy image into the atlas: "s
+                               + images[i].second,
+        SDL_GetError(), __FILE__, __LINE__ };
+    }
+  }
+
+  // Custom deleter is used due to specific SDL texture destructon function
+  sdl_texture_
+      = std::unique_ptr<SDL_Texture, std::function<void(SDL_Texture*)>> {
+          SDL_CreateTextureFromSurface(gameRenderer, atlas.get()),
+          [](SDL_Texture* ptr) { SDL_DestroyTexture(ptr); }
+        };
+  if (!sdl_texture_) {
+    throw SDLexception { "Failed to create the sprite atlas texture",
+      SDL_GetError(), __FILE__, __LINE__ };
+  }
+  SDL_SetTextureBlendMode(sdl_texture_.get(), SDL_BLENDMODE_BLEND);
+
+  // index the regions by the numeric value of the sprite
+  for (std::size_t i = 0; i < images.size(); i++) {
+    const auto slot = static_cast<std::size_t>(images[i].first);
+    if (regions_.size() <= slot) {
+      regions_.resize(slot + 1, SDL_Rect { 0, 0, 0, 0 });
+    }
+    regions_[slot] = placed[i];
+  }
+}
+
+// checks if the atlas contains the sprite
+bool SpriteAtlas::Contains(Sprite sprite) const
+{
+  return Region(sprite).w > 0;
+}
+
+// returns the region of the atlas occupied by the sprite (empty if the atlas
+// doesn't contain the sprite)
+const SDL_Rect& SpriteAtlas::Region(Sprite sprite) const
+{
+  static const SDL_Rect empty { 0, 0, 0, 0 };
+  const auto slot = static_cast<std::size_t>(sprite);
+  return slot < regions_.size() ? regions_[slot] : empty;
+}
@@ -2,21 +2,32 @@
 
 // Constructor.
 // Takes: x,y coordinates of text element on the screen,
-// path of the font file, color of text, size of text (pixels), renderer
-// (for texture creation and rendering) and the text to be displayed.
-//  May throw SDLexception if construction of member texture_ fails
+// path of the font file, color of text, size of text (pixels), text engine
+// (for font loading and rendering) and the text to be displayed.
+// May throw SDLexception if opening the font or rendering its glyphs fails
 TextElement::TextElement(float x, float y, const std::string& fontPath,
-    SDL_Color color, int textSize, SDL_Renderer* gameRenderer,
+    SDL_Color color, int textSize, TextEngine& textEngine,
     const std::string& text)
     : StaticObject(x, y)
-    , texture_(std::make_unique<Texture>(
-          fontPath, color, textSize, gameRenderer, text))
+    , text_engine_(textEngine)
+    , font_(textEngine.Font(fontPath, textSize))
+    , color_(color)
+    , text_(text)
+    , size_(textEngine.Measure(font_, text))
 {
 }
 
-// Displays text onto the screen
-void TextElement::Draw() const
+// Replaces the displayed text, keeping the text element centred at the same
+// position. May throw SDLexception if rendering glyphs fails
+void TextElement::SetText(const std::string& text)
 {
-  texture_->Render(
-      static_cast<int>(position_.X()), static_cast<int>(position_.Y()));
+  text_ = text;
+  size_ = text_engine_.Measure(font_, text_);
+}
+
+// adds the commands displaying the text to the draw list
+void TextElement::Draw(DrawList& drawList) const
+{
+  text_engine_.Draw(drawList, DrawLayer::Text, font_, text_, color_,
+      position_.X(), position_.Y());
 }
@@ -0,0 +1,202 @@
+#include "TextEngine.hpp"
+#include "SDLexception.hpp"
+#include <algorithm>
+
+// for operator""s usage
+using std::string_literals::operator""s;
+
+// pointer for temporary SDL_Surface with custom deleter
+using SurfacePtr
+    = std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface*)>>;
+
+// Constructor. Takes the renderer used for texture creation and drawing and the
+// loader reading the fonts (it must outlive the engine, as the fonts keep
+// reading their streams)
+TextEngine::TextEngine(SDL_Renderer* gameRenderer, const AssetLoader& assets)
+    : sdl_renderer_(gameRenderer)
+    , assets_(assets)
+{
+}
+
+// Returns the font of the file with the given size (pixels), opening it on the
+// first request. Throws SDLexception if opening the font fails
+TextEngine::FontId TextEngine::Font(const std::string& fontPath, int textSize)
+{
+  const auto key = std::make_pair(fontPath, textSize);
+  if (auto found = font_ids_.find(key); found != font_ids_.end()) {
+    return found->second;
+  }
+
+  // custom deleter is used due to specific SDL destruction function; the
+  // stream is closed together with the font
+  fonts_.emplace_back(TTF_OpenFontRW(assets_.Open(fontPath), 1, textSize),
+      [](TTF_Font* ptr) { TTF_CloseFont(ptr); });
+  if (!fonts_.back()) {
+    fonts_.pop_back();
+    throw SDLexception("Failed to open font from path: "s + fontPath,
+        TTF_GetError(), __FILE__, __LINE__);
+  }
+  const FontId id = fonts_.size() - 1;
+  font_ids_.emplace(key, id);
+  return id;
+}
+
+// returns the size (width and height) of the text displayed with the font.
+// May throw SDLexception if rendering a glyph fails
+SDL_Point TextEngine::Measure(FontId font, std::string_view text)
+{
+  TTF_Font* ttf_font = fonts_.at(font).get();
+  int width { 0 };
+  Uint16 previous { 0 };
+  for (unsigned char c : text) {
+    const Uint16 character { c };
+    if (previous != 0) {
+      width += TTF_GetFontKerningSizeGlyphs(ttf_font, previous, character);
+    }
+    width += GetGlyph(font, character).advance;
+    previous = character;
+  }
+  return SDL_Point { width, TTF_FontHeight(ttf_font) };
+}
+
+// adds the commands drawing the text centred at the given position within the
+// layer to the draw list. May throw SDLexception if rendering a glyph fails
+void TextEngine::Draw(DrawList& drawList, DrawLayer layer, FontId font,
+    std::string_view text, SDL_Color color, float centreX, float centreY)
+{
+  const SDL_Point size = Measure(font, text);
+  // top-left corner rounded to whole pixels the same way as for the sprites
+  DrawAt(drawList, layer, font, text, color,
+      static_cast<int>(centreX) - size.x / 2,
+      static_cast<int>(centreY) - size.y / 2);
+}
+
+// adds the commands drawing the text with its top-left corner at the given
+// position within the layer to the draw list; unlike Draw() it doesn't measure
+// the text. May throw SDLexception if rendering a glyph fails
+void TextEngine::DrawAt(DrawList& drawList, DrawLayer layer, FontId font,
+    std::string_view text, SDL_Color color, int left, int top)
+{
+  // the colours of the game leave the alpha unset, so the texts are opaque
+  const SDL_Color tint { color.r, color.g, color.b, 255 };
+  TTF_Font* ttf_font = fonts_.at(font).get();
+  int pen_x = left;
+
+  Uint16 previous { 0 };
+  for (unsigned char c : text) {
+    const Uint16 character { c };
+    if (previous != 0) {
+      pen_x += TTF_GetFontKerningSizeGlyphs(ttf_font, previous, character);
+    }
+    const Glyph& glyph = GetGlyph(font, character);
+    // the texts stay aligned to whole pixels, so the glyphs are sharp
+    const SDL_FRect destination { static_cast<float>(pen_x + glyph.offset_x),
+      static_cast<float>(top), static_cast<float>(glyph.region.w),
+      static_cast<float>(glyph.region.h) };
+    drawList.Add(layer, pages_[glyph.page].get(), glyph.region, destination,
+        tint);
+
+    pen_x += glyph.advance;
+    previous = character;
+  }
+}
+
+// renders the glyphs of all the characters in advance, so drawing texts made
+// of them later doesn't render anything. May throw SDLexception if rendering a
+// glyph fails
+void TextEngine::Preload(FontId font, std::string_view characters)
+{
+  for (unsigned char c : characters) {
+    GetGlyph(font, Uint16 { c });
+  }
+}
+
+// returns the glyph of the character, rendering it on its first use
+const TextEngine::Glyph& TextEngine::GetGlyph(FontId font, Uint16 character)
+{
+  const std::uint64_t key = (static_cast<std::uint64_t>(font) << 16)
+      | static_cast<std::uint64_t>(character);
+  auto found = glyphs_.find(key);
+  if (found == glyphs_.end()) {
+    found = glyphs_.emplace(key, RenderGlyph(font, character)).first;
+  }
+  return found->second;
+}
+
+// renders the glyph of the character into the atlas
+TextEngine::Glyph TextEngine::RenderGlyph(FontId font, Uint16 character)
+{
+  TTF_Font* ttf_font = fonts_[font].get();
+  auto free_surface = [](SDL_Surface* ptr) { SDL_FreeSurface(ptr); };
+
+  // The character is rendered as a one-character text, so the surface spans
+  // the whole line height with the glyph placed on the baseline of the font,
+  // and starts at the smaller of the pen position and the glyph's left edge
+  const char text[] = { static_cast<char>(character), '\0' };
+  SurfacePtr rendered { TTF_RenderText_Blended(
+                            ttf_font, text, SDL_Color { 255, 255, 255, 255 }),
+    free_surface };
+  if (!rendered) {
+    throw SDLexception("Failed to render glyph: "s + text, TTF_GetError(),
+        __FILE__, __LINE__);
+  }
+  int min_x { 0 };
+  int advance { 0 };
+  TTF_GlyphMetrics(
+      ttf_font, character, &min_x, nullptr, nullptr, nullptr, &advance);
+
+  // copy the glyph into a transparent surface with the margins
+  SurfacePtr padded { SDL_CreateRGBSurfaceWithFormat(0,
+                          rendered->w + 2 * padding, rendered->h + 2 * padding,
+                          32, SDL_PIXELFORMAT_RGBA32),
+    free_surface };
+  if (!padded) {
+    throw SDLexception(
+        "Failed to create glyph surface", SDL_GetError(), __FILE__, __LINE__);
+  }
+  SDL_FillRect(padded.get(), nullptr, 0);
+  SDL_SetSurfaceBlendMode(rendered.get(), SDL_BLENDMODE_NONE);
+  SDL_Rect inside { padding, padding, rendered->w, rendered->h };
+  SDL_BlitSurface(rendered.get(), nullptr, padded.get(), &inside);
+
+  // start a new shelf if the glyph doesn't fit into the current one and a new
+  // page if the shelf doesn't fit into the page
+  if (pages_.empty()) {
+    AddPage();
+  }
+  if (shelf_x_ + padded->w > page_size) {
+    shelf_y_ += shelf_height_;
+    shelf_x_ = 0;
+    shelf_height_ = 0;
+  }
+  if (shelf_y_ + padded->h > page_size) {
+    AddPage();
+  }
+  SDL_Rect area { shelf_x_, shelf_y_, padded->w, padded->h };
+  SDL_UpdateTexture(pages_.back().get(), &area, padded->pixels,
+      padded->pitch);
+  shelf_x_ += padded->w;
+  shelf_height_ = std::max(shelf_height_, padded->h);
+
+  return Glyph { pages_.size() - 1,
+    SDL_Rect { area.x + padding, area.y + padding, rendered->w, rendered->h },
+    std::min(min_x, 0), advance };
+}
+
+// adds an empty page to the atlas
+void TextEngine::AddPage()
+{
+  // custom deleter is used due to specific SDL texture destructon function
+  pages_.emplace_back(SDL_CreateTexture(sdl_renderer_, SDL_PIXELFORMAT_RGBA32,
+                          SDL_TEXTUREACCESS_STATIC, page_size, page_size),
+      [](SDL_Texture* ptr) { SDL_DestroyTexture(ptr); });
+  if (!pages_.back()) {
+    pages_.pop_back();
+    throw SDLexception("Failed to create the glyph atlas texture",
+        SDL_GetError(), __FILE__, __LINE__);
+  }
+  SDL_SetTextureBlendMode(pages_.back().get(), SDL_BLENDMODE_BLEND);
+  shelf_x_ = 0;
+  shelf_y_ = 0;
+  shelf_height_ = 0;
+}
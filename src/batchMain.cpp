@@ -0,0 +1,198 @@
+#include "BatchRunner.hpp"
+#include "Paths.hpp"
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// for operator""s usage
+using namespace std::string_literals;
+
+namespace {
+// description of the command line arguments
+constexpr const char* usage {
+  "Usage: arkanoidBatch [--assets dir] [games] [threads] [seed] [level] "
+  "[jump]\n"
+  "  --assets dir  directory with the assets (by default the asset pack or\n"
+  "                the assets directory found next to the executable, or\n"
+  "                else the assets of the source tree it was built from)\n"
+  "  games         number of games to play (default 100)\n"
+  "  threads       number of worker threads, 0 means one per hardware core\n"
+  "                (default 0)\n"
+  "  seed          seed of the first game (default 1)\n"
+  "  level         level played in every game (default 1)\n"
+  "  jump          1 jumps from event to event instead of making every\n"
+  "                simulation step; faster, but plays other games than\n"
+  "                stepping (default 0)\n"
+};
+
+// Reads the unsigned number passed as the named argument. Throws
+// std::invalid_argument if the text is not a number, or if the number is 0 and
+// zero is not allowed
+unsigned ReadNumber(const char* text, const char* name, bool zeroAllowed)
+{
+  unsigned value { 0 };
+  const char* end = text + std::strlen(text);
+  const auto result = std::from_chars(text, end, value);
+  if (result.ec != std::errc {} || result.ptr != end
+      || (!zeroAllowed && value == 0)) {
+    throw std::invalid_argument("Invalid "s + name + ": "s + text);
+  }
+  return value;
+}
+
+// returns the directory of the running executable, or an empty path if it
+// can't be found
+std::filesystem::path ExecutableDirectory(const char* argv0)
+{
+  std::error_code error;
+  // the symbolic link exists on Linux; the path the executable was started
+  // with is used elsewhere
+  auto executable = std::filesystem::read_symlink("/proc/self/exe", error);
+  if (error) {
+    executable = std::filesystem::absolute(argv0, error);
+  }
+  return error ? std::filesystem::path {} : executable.parent_path();
+}
+}
+
+// Plays a batch of games without display and prints their results.
+// Usage: arkanoidBatch [--assets dir] [games] [threads] [seed] [level] [jump]
+// (threads equal to 0 means one thread per hardware core; jump equal to 1
+// jumps from event to event instead of making every simulation step). The
+// levels are read from the assets directory given, or else from the asset
+// pack next to the executable, or else from the assets directory next to it
+// (as seen from the build directory), or else from the source tree the
+// executable was built from, so it can be started from any directory.
+int main(int argc, char const* argv[])
+{
+  // constants for game settings
+  constexpr unsigned c_implemented_levels { 10 };
+  constexpr std::size_t c_simulation_rate { 240 };
+
+  try {
+    // split the options from the positional arguments
+    std::string assets_path;
+    std::vector<const char*> numbers;
+    for (int i = 1; i < argc; i++) {
+      if (argv[i] == "--help"s || argv[i] == "-h"s) {
+        std::cout << usage;
+        return 0;
+      }
+      if (argv[i] == "--assets"s && i + 1 < argc) {
+        assets_path = argv[++i];
+      }
+      else if (argv[i][0] == '-' || numbers.size() == 5) {
+        throw std::invalid_argument("Unexpected argument: "s + argv[i]);
+      }
+      else {
+        numbers.push_back(argv[i]);
+      }
+    }
+
+    BatchSettings settings;
+    settings.levels_path = Paths::pLevels;
+    settings.levels_implemented = c_implemented_levels;
+    settings.time_step = 1.0f / c_simulation_rate;
+    // read the optional numerical arguments
+    if (numbers.size() > 0) {
+      settings.games = ReadNumber(numbers[0], "number of games", false);
+    }
+    if (numbers.size() > 1) {
+      settings.threads = ReadNumber(numbers[1], "number of threads", true);
+    }
+    if (numbers.size() > 2) {
+      settings.seed = ReadNumber(numbers[2], "seed", true);
+    }
+    if (numbers.size() > 3) {
+      settings.level = ReadNumber(numbers[3], "level", false);
+      if (settings.level > c_implemented_levels) {
+        throw std::invalid_argument("Invalid level: "s + numbers[3]);
+      }
+    }
+    if (numbers.size() > 4) {
+      settings.event_jumping = ReadNumber(numbers[4], "jump", true) != 0;
+    }
+
+    // find the level data
+    std::unique_ptr<AssetPack> pack;
+    const auto executable_directory = ExecutableDirectory(argv[0]);
+    const auto pack_path = executable_directory / Paths::pAssetPack;
+    if (!assets_path.empty()) {
+      settings.levels_path = (std::filesystem::path(assets_path) / "levels")
+                                 .generic_string()
+          + "/";
+    }
+    else if (!executable_directory.empty()
+        && std::filesystem::is_regular_file(pack_path)) {
+      pack = std::make_unique<AssetPack>(pack_path.string(), Paths::pAssets);
+      settings.assets = pack.get();
+    }
+    else if (!executable_directory.empty()
+        && std::filesystem::is_directory(
+            executable_directory / Paths::pLevels)) {
+      settings.levels_path
+          = (executable_directory / Paths::pLevels).generic_string();
+    }
+#ifdef ARKANOID_LEVELS_DIR
+    // e.g. a build directory outside the source tree
+    else if (std::filesystem::is_directory(ARKANOID_LEVELS_DIR)) {
+      settings.levels_path = ARKANOID_LEVELS_DIR;
+    }
+#endif
+    if (!settings.assets
+        && !std::filesystem::is_directory(settings.levels_path)) {
+      throw std::invalid_argument(
+          "Level data not found; pass the assets directory with --assets");
+    }
+
+    BatchRunner runner { settings };
+    const auto start = std::chrono::steady_clock::now();
+    const auto results = runner.Run();
+    const std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+
+    // print results of every game
+    std::cout << "seed\tcleared\tscore\ttime[s]\tlost\tbounces\n";
+    unsigned cleared { 0 };
+    for (const auto& result : results) {
+      std::cout << result.seed << '\t' << (result.cleared ? "yes" : "no")
+                << '\t' << result.score << '\t' << std::fixed
+                << std::setprecision(2) << result.time << '\t'
+                << result.balls_lost << '\t' << result.bounces << '\n';
+      cleared += result.cleared ? 1 : 0;
+    }
+
+    // print the summary
+    std::cout << "games: " << results.size() << ", cleared: " << cleared
+              << ", wall time: " << std::setprecision(3) << elapsed.count()
+              << " s, games/s: "
+              << (elapsed.count() > 0.0 ? results.size() / elapsed.count()
+                                        : 0.0)
+              << std::endl;
+    return 0;
+  }
+  // handle invalid arguments
+  catch (const std::invalid_argument& e) {
+    std::cerr << e.what() << '\n' << usage;
+    return -1;
+  }
+  // handle standard iherited exceptions
+  catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -2;
+  }
+  // handle unpredicted exceptions
+  catch (...) {
+    std::cerr << "Unknown exception occured!" << std::endl;
+    return -3;
+  }
+}
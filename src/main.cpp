@@ -1,23 +1,82 @@
 #include "Game.hpp"
 #include "SDLexception.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <exception>
 #include <iostream>
+#include <random>
+#include <string>
 
+// Runs the game in a window.
+// Usage: simpleArkanoid [--offscreen [frames]] [--seed seed] [--record path]
+// (--offscreen renders the game played by the autopilot into memory, without
+// a display, and prints the hash of every frame and the frame statistics
+// every second; frames limits the number of frames, 0 meaning no limit.
+// --seed sets the seed of the random numbers of the game; by default it is
+// random in a window and fixed offscreen, so offscreen runs are
+// reproducible.
+// --record writes the displayed frames to a Y4M video if the path ends with
+// ".y4m", or to a sequence of PNG images named path_000000.png etc. otherwise)
 int main(int argc, char const* argv[])
 {
   // constants for game settings
   constexpr std::size_t c_screen_width { 1024 };
   constexpr std::size_t c_screen_height { 768 };
   constexpr std::size_t c_frames_per_second { 60 };
+  constexpr std::size_t c_simulation_rate { 240 };
   constexpr unsigned c_implemented_levels { 10 };
+  constexpr std::uint64_t c_offscreen_seed { 1 };
 
   try {
+    // read the optional command line arguments
+    RenderMode render_mode { RenderMode::Window };
+    std::size_t max_frames { 0 };
+    std::string record_path;
+    bool seed_given { false };
+    std::uint64_t seed { 0 };
+    for (int i = 1; i < argc; i++) {
+      if (std::strcmp(argv[i], "--offscreen") == 0) {
+        render_mode = RenderMode::Offscreen;
+        // no display server nor sound device is needed, unless the drivers
+        // are chosen explicitly
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+        // the number of frames is optional
+        if (i + 1 < argc && argv[i + 1][0] != '-') {
+          max_frames = std::strtoul(argv[++i], nullptr, 10);
+        }
+      }
+      else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+        record_path = argv[++i];
+      }
+      else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+        seed = std::strtoull(argv[++i], nullptr, 10);
+        seed_given = true;
+      }
+    }
+    if (!seed_given) {
+      seed = render_mode == RenderMode::Offscreen ? c_offscreen_seed
+                                                  : std::random_device {}();
+    }
+
     // create the main game object
     Game simple_arkanoid(c_screen_height, c_screen_width, c_frames_per_second,
-        c_implemented_levels);
+        c_simulation_rate, c_implemented_levels, render_mode, seed);
+
+    // record the game if requested
+    if (!record_path.empty()) {
+      const std::string video_extension { ".y4m" };
+      const bool is_video = record_path.size() > video_extension.size()
+          && record_path.compare(record_path.size() - video_extension.size(),
+                 video_extension.size(), video_extension)
+              == 0;
+      simple_arkanoid.Record(record_path,
+          is_video ? CaptureFormat::Y4m : CaptureFormat::PngSequence);
+    }
 
     // run the main loop
-    simple_arkanoid.Run();
+    simple_arkanoid.Run(max_frames);
 
     return 0;
   }
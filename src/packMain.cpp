@@ -0,0 +1,214 @@
+#include "AssetPack.hpp"
+#include "SDL.h"
+#include "SDL_image.h"
+#include "SDLexception.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// for operator""s usage
+using namespace std::string_literals;
+
+namespace {
+// an asset to be written into the pack
+struct PackedAsset
+{
+  // path relative to the assets directory, with '/' separators
+  std::string name;
+  AssetKind kind = AssetKind::File;
+  unsigned width = 0;
+  unsigned height = 0;
+  std::vector<char> data;
+};
+
+// extensions of the files used by the game; the other files (e.g. the
+// spreadsheet helping to design the levels) are not packed
+const std::vector<std::string> packed_extensions { ".png", ".ttf", ".wav",
+  ".txt" };
+
+// reads the whole file; throws std::runtime_error if it can't be read
+std::vector<char> ReadFile(const std::filesystem::path& path)
+{
+  std::ifstream file { path, std::ios::binary };
+  if (!file) {
+    throw std::runtime_error("Unable to read asset: "s + path.string());
+  }
+  return std::vector<char>(std::istreambuf_iterator<char>(file),
+      std::istreambuf_iterator<char>());
+}
+
+// Decodes the image into RGBA32 pixels stored row after row. Throws
+// SDLexception if decoding or converting the image fails
+void DecodeImage(const std::filesystem::path& path, PackedAsset& asset)
+{
+  auto free_surface = [](SDL_Surface* ptr) { SDL_FreeSurface(ptr); };
+  std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface*)>> loaded {
+    IMG_Load(path.string().c_str()), free_surface
+  };
+  if (!loaded) {
+    throw SDLexception { "Unable to load image: "s + path.string(),
+      IMG_GetError(), __FILE__, __LINE__ };
+  }
+  std::unique_ptr<SDL_Surface, std::function<void(SDL_Surface*)>> converted {
+    SDL_ConvertSurfaceFormat(loaded.get(), SDL_PIXELFORMAT_RGBA32, 0),
+    free_surface
+  };
+  if (!converted) {
+    throw SDLexception { "Unable to convert image: "s + path.string(),
+      SDL_GetError(), __FILE__, __LINE__ };
+  }
+
+  asset.kind = AssetKind::RgbaImage;
+  asset.width = static_cast<unsigned>(converted->w);
+  asset.height = static_cast<unsigned>(converted->h);
+  const std::size_t row_size = asset.width * 4;
+  asset.data.resize(row_size * asset.height);
+  // the rows of the surface may be padded
+  const auto* pixels = static_cast<const char*>(converted->pixels);
+  for (unsigned row = 0; row < asset.height; row++) {
+    std::copy_n(pixels + row * converted->pitch, row_size,
+        asset.data.begin() + row * row_size);
+  }
+}
+
+// writes the little-endian number of the given size (bytes)
+void WriteNumber(std::ostream& stream, std::uint64_t value, std::size_t bytes)
+{
+  for (std::size_t i = 0; i < bytes; i++) {
+    stream.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+// writes the pack with the assets; throws std::runtime_error on failure
+void WritePack(const std::string& packPath,
+    const std::vector<PackedAsset>& assets)
+{
+  // the data follows the index and every asset starts aligned
+  const auto align = [](std::uint64_t offset) {
+    return (offset + AssetPack::alignment - 1) / AssetPack::alignment
+        * AssetPack::alignment;
+  };
+  std::uint64_t offset { AssetPack::magic.size() + 4 };
+  for (const auto& asset : assets) {
+    offset += AssetPack::index_entry_size + asset.name.size();
+  }
+  std::vector<std::uint64_t> offsets;
+  for (const auto& asset : assets) {
+    offset = align(offset);
+    offsets.push_back(offset);
+    offset += asset.data.size();
+  }
+
+  std::ofstream pack { packPath, std::ios::binary | std::ios::trunc };
+  if (!pack) {
+    throw std::runtime_error("Unable to create asset pack: "s + packPath);
+  }
+  pack.write(AssetPack::magic.data(), AssetPack::magic.size());
+  WriteNumber(pack, assets.size(), 4);
+  for (std::size_t i = 0; i < assets.size(); i++) {
+    WriteNumber(pack, assets[i].name.size(), 4);
+    WriteNumber(pack, static_cast<std::uint64_t>(assets[i].kind), 4);
+    WriteNumber(pack, assets[i].width, 4);
+    WriteNumber(pack, assets[i].height, 4);
+    WriteNumber(pack, offsets[i], 8);
+    WriteNumber(pack, assets[i].data.size(), 8);
+    pack.write(assets[i].name.data(), assets[i].name.size());
+  }
+  for (std::size_t i = 0; i < assets.size(); i++) {
+    // pad up to the aligned offset of the asset
+    while (static_cast<std::uint64_t>(pack.tellp()) < offsets[i]) {
+      pack.put('\0');
+    }
+    pack.write(assets[i].data.data(), assets[i].data.size());
+  }
+  if (!pack) {
+    throw std::runtime_error("Unable to write asset pack: "s + packPath);
+  }
+}
+}
+
+// Packs all the assets used by the game into a single file.
+// Usage: arkanoidPack <assets directory> <pack file> [--decode-images]
+// (--decode-images stores the images as RGBA32 pixels, so the game doesn't
+// decode them at startup; the sounds are stored as they are, the WAV files
+// already holding PCM samples)
+int main(int argc, char const* argv[])
+{
+  try {
+    if (argc < 3) {
+      std::cerr << "Usage: arkanoidPack <assets directory> <pack file> "
+                   "[--decode-images]"
+                << std::endl;
+      return -1;
+    }
+    const std::filesystem::path assets_path { argv[1] };
+    const std::string pack_path { argv[2] };
+    const bool decode_images = argc > 3 && argv[3] == "--decode-images"s;
+
+    // the same assets always give the same pack
+    std::vector<std::filesystem::path> files;
+    for (const auto& item :
+        std::filesystem::recursive_directory_iterator(assets_path)) {
+      const auto extension = item.path().extension().string();
+      if (item.is_regular_file()
+          && std::find(packed_extensions.begin(), packed_extensions.end(),
+                 extension)
+              != packed_extensions.end()) {
+        files.push_back(item.path());
+      }
+    }
+    std::sort(files.begin(), files.end());
+
+    // SDL_image needs no subsystem but the PNG support
+    if (decode_images && (IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG) == 0) {
+      throw SDLexception { "Unable to initialize PNG support", IMG_GetError(),
+        __FILE__, __LINE__ };
+    }
+    std::vector<PackedAsset> assets;
+    for (const auto& file : files) {
+      PackedAsset asset;
+      asset.name
+          = std::filesystem::relative(file, assets_path).generic_string();
+      if (decode_images && file.extension() == ".png") {
+        DecodeImage(file, asset);
+      }
+      else {
+        asset.data = ReadFile(file);
+      }
+      assets.push_back(std::move(asset));
+    }
+    if (decode_images) {
+      IMG_Quit();
+    }
+
+    WritePack(pack_path, assets);
+    std::cout << "packed " << assets.size() << " assets into " << pack_path
+              << std::endl;
+    return 0;
+  }
+  // handle exceptions thrown by SDL
+  catch (const SDLexception& e) {
+    std::cerr << e.Description();
+    return -1;
+  }
+  // handle standard iherited exceptions
+  catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return -2;
+  }
+  // handle unpredicted exceptions
+  catch (...) {
+    std::cerr << "Unknown exception occured!" << std::endl;
+    return -3;
+  }
+}
@@ -0,0 +1,412 @@
+#include "Arena.hpp"
+#include "BatchRunner.hpp"
+#include "BlockField.hpp"
+#include "BlockGrid.hpp"
+#include "Collision.hpp"
+#include "CollisionScheduler.hpp"
+#include "EventQueue.hpp"
+#include "TripleBuffer.hpp"
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Tests of the game core (no SDL needed). Every test is registered in CTest
+// separately; run with a test name to run that test only, or without
+// arguments to run all of them.
+// Usage: arkanoidTests [test name]
+
+namespace {
+// number of failed checks of the test being run
+unsigned failures = 0;
+
+// reports the failed check; the test goes on with the next one
+void Check(bool condition, const char* expression, const char* file,
+    int line)
+{
+  if (!condition) {
+    std::cerr << file << ":" << line << ": check failed: " << expression
+              << std::endl;
+    failures++;
+  }
+}
+
+// checks the condition, reporting the expression and its place if it fails
+#define CHECK(condition) Check((condition), #condition, __FILE__, __LINE__)
+
+// checks if the values differ by no more than the tolerance
+bool Near(float lhs, float rhs, float tolerance = 1e-4f)
+{
+  return std::fabs(lhs - rhs) <= tolerance;
+}
+
+// ------ SWEPT COLLISIONS ------//
+// the rectangle of the tests: centre (0, 0), 20 x 20 pixels, and the radius
+// of the swept circle
+const gMath::Vector2d rect_centre { 0.0f, 0.0f };
+constexpr float half_size { 10.0f };
+constexpr float radius { 2.0f };
+
+// sweeps the circle against the rectangle of the tests
+bool Sweep(const gMath::Vector2d& start, const gMath::Vector2d& displacement,
+    gMath::SweepHit& hit)
+{
+  return gMath::SweepCircleRect(start, displacement, radius, rect_centre,
+      half_size, half_size, hit);
+}
+
+// a circle heading straight at a border hits it when it gets a radius away
+void TestSweepHeadOn()
+{
+  gMath::SweepHit hit;
+  CHECK(Sweep({ 0.0f, -30.0f }, { 0.0f, 36.0f }, hit));
+  CHECK(Near(hit.time, 0.5f));
+  CHECK(hit.border == RectBorder::Top);
+  CHECK(Near(hit.normal.X(), 0.0f) && Near(hit.normal.Y(), -1.0f));
+  // the displacement ends before the contact
+  CHECK(!Sweep({ 0.0f, -30.0f }, { 0.0f, 17.0f }, hit));
+}
+
+// a circle sliding along a border it touches never hits it, but hits it at
+// once when heading into it
+void TestSweepTangent()
+{
+  gMath::SweepHit hit;
+  const float touching_y = -half_size - radius;
+  CHECK(!Sweep({ -5.0f, touching_y }, { 10.0f, 0.0f }, hit));
+  CHECK(!Sweep({ -30.0f, touching_y }, { 60.0f, 0.0f }, hit)
+      || Near(gMath::Dot(hit.normal, { 60.0f, 0.0f }), 0.0f));
+  CHECK(Sweep({ -5.0f, touching_y }, { 0.0f, 5.0f }, hit));
+  CHECK(Near(hit.time, 0.0f));
+  CHECK(hit.border == RectBorder::Top);
+}
+
+// an overlapping circle hits the least penetrated border at time 0 only when
+// it heads deeper, so a ball which has just bounced can always escape
+void TestSweepStartOverlapping()
+{
+  gMath::SweepHit hit;
+  CHECK(Sweep({ 0.0f, -11.0f }, { 0.0f, 5.0f }, hit));
+  CHECK(hit.time == 0.0f);
+  CHECK(hit.border == RectBorder::Top);
+  CHECK(!Sweep({ 0.0f, -11.0f }, { 0.0f, -5.0f }, hit));
+  CHECK(!Sweep({ 0.0f, -11.0f }, { 0.0f, 0.0f }, hit));
+}
+
+// a circle heading at a corner touches the rounded corner of the expanded
+// rectangle, while one passing the corner closer than the radius of the
+// expanded square (but farther than the rounded corner) misses it
+void TestSweepCorner()
+{
+  gMath::SweepHit hit;
+  CHECK(Sweep({ -30.0f, -30.0f }, { 40.0f, 40.0f }, hit));
+  const float diagonal = radius / std::sqrt(2.0f);
+  CHECK(Near(hit.time, (20.0f - diagonal) / 40.0f));
+  CHECK(Near(hit.normal.X(), -1.0f / std::sqrt(2.0f))
+      && Near(hit.normal.Y(), -1.0f / std::sqrt(2.0f)));
+  // the closest point of the path is 2.12 pixels away from the corner
+  CHECK(!Sweep({ -21.5f, -1.5f }, { 20.0f, -20.0f }, hit));
+}
+
+// Shoots the ball of a new game straight up at the lowest block, from 50
+// pixels below it, and makes a single update in which the ball would travel
+// 200 pixels, far past the block. The block must be hit, and the ball must
+// bounce back and end the update below the block
+void CheckNoTunnelling(float speedFactor)
+{
+  Arena arena { ArenaLayout {}, ARKANOID_LEVELS_DIR, 10, 1 };
+  const BlockField& blocks = arena.Blocks();
+  std::size_t target { 0 };
+  for (std::size_t i = 1; i < blocks.Size(); i++) {
+    if (blocks.Position(i).Y() > blocks.Position(target).Y()) {
+      target = i;
+    }
+  }
+  const gMath::Vector2d block = blocks.Position(target);
+  const float block_bottom = block.Y() + blocks.HalfHeight(target);
+
+  Ball& ball = *arena.Balls().begin();
+  ball.Start();
+  ball.SetSpeed(ball.Speed() * speedFactor);
+  ball.SetDirection(gMath::Vector2d(0.0f, -1.0f));
+  ball.SetPosition(block.X(), block_bottom + 50.0f);
+  ball.Update(200.0f / ball.Speed());
+
+  CHECK(blocks.IsDestroyed(target));
+  CHECK(arena.Events().Contains(GameEvent::BlockDestroyed));
+  CHECK(ball.Velocity().Y() > 0.0f);
+  CHECK(ball.Position().Y() - ball.Radius() >= block_bottom - 1e-3f);
+}
+
+// a ball a hundred times faster than the level speed doesn't pass through
+// a block
+void TestNoTunnellingFastBall() { CheckNoTunnelling(100.0f); }
+
+// a ball at the level speed doesn't pass through a block within a long update
+// (e.g. after a frame hitch)
+void TestNoTunnellingLongStep() { CheckNoTunnelling(1.0f); }
+
+// ------ COLLISION SCHEDULER ------//
+// the invalidated entries are skipped, whether they are earlier or later
+// than the valid ones
+void TestSchedulerStaleEntries()
+{
+  const double infinity = std::numeric_limits<double>::infinity();
+  CollisionScheduler scheduler { 3 };
+  CHECK(scheduler.NextEventTime() == infinity);
+
+  scheduler.Schedule(0, 1.0);
+  scheduler.Schedule(1, 3.0);
+  // the entry at 1.0 becomes stale but stays at the top of the queue
+  scheduler.Schedule(0, 5.0);
+  CHECK(scheduler.NextEventTime() == 3.0);
+  CHECK(scheduler.IsFreeUntil(0, 4.0));
+  CHECK(!scheduler.IsFreeUntil(1, 4.0));
+
+  scheduler.Cancel(1);
+  CHECK(scheduler.NextEventTime() == 5.0);
+  CHECK(!scheduler.IsFreeUntil(1, 0.0));
+
+  // rescheduling earlier leaves the later entry stale
+  scheduler.Schedule(0, 2.0);
+  scheduler.Schedule(2, 4.0);
+  CHECK(scheduler.NextEventTime() == 2.0);
+  scheduler.Cancel(0);
+  CHECK(scheduler.NextEventTime() == 4.0);
+
+  scheduler.CancelAll();
+  CHECK(scheduler.NextEventTime() == infinity);
+}
+
+// rescheduling many times without asking for the next event compacts the
+// queue and keeps only the last entry of every slot
+void TestSchedulerCompaction()
+{
+  CollisionScheduler scheduler { 2 };
+  for (unsigned i = 0; i < 100; i++) {
+    scheduler.Schedule(0, 100.0 - i);
+    scheduler.Schedule(1, 200.0 + i);
+  }
+  CHECK(scheduler.NextEventTime() == 1.0);
+  scheduler.Cancel(0);
+  CHECK(scheduler.NextEventTime() == 299.0);
+}
+
+// ------ BLOCKS ------//
+// collects the indexes of the blocks in the area
+template <typename Container>
+std::vector<std::size_t> BlocksInArea(
+    const Container& blocks, float minX, float minY, float maxX, float maxY)
+{
+  std::vector<std::size_t> found;
+  blocks.ForEachInArea(minX, minY, maxX, maxY,
+      [&found](std::size_t index) { found.push_back(index); });
+  return found;
+}
+
+// the area visits every block in the overlapped cells once
+void TestBlockGridQueries()
+{
+  // 4 x 3 cells of 10 x 5 pixels starting at (100, 50)
+  BlockGrid grid { 100.0f, 50.0f, 10.0f, 5.0f, 4, 3 };
+  grid.Insert(0, 0, 7);
+  grid.Insert(3, 2, 8);
+  grid.Insert(1, 1, 9);
+
+  CHECK(BlocksInArea(grid, 0.0f, 0.0f, 1000.0f, 1000.0f).size() == 3);
+  CHECK(BlocksInArea(grid, 100.0f, 50.0f, 105.0f, 52.0f)
+      == std::vector<std::size_t> { 7 });
+  // the area spans the border of two cells
+  CHECK(BlocksInArea(grid, 109.0f, 54.0f, 111.0f, 56.0f)
+      == (std::vector<std::size_t> { 7, 9 }));
+  // outside the grid
+  CHECK(BlocksInArea(grid, 0.0f, 0.0f, 99.0f, 49.0f).empty());
+  CHECK(BlocksInArea(grid, 140.0f, 65.0f, 150.0f, 70.0f).empty());
+
+  grid.Remove(gMath::Vector2d(115.0f, 57.5f));
+  CHECK(BlocksInArea(grid, 0.0f, 0.0f, 1000.0f, 1000.0f).size() == 2);
+  // removing outside the grid does nothing
+  grid.Remove(gMath::Vector2d(0.0f, 0.0f));
+  grid.Clear();
+  CHECK(BlocksInArea(grid, 0.0f, 0.0f, 1000.0f, 1000.0f).empty());
+
+  bool thrown = false;
+  try {
+    grid.Insert(4, 0, 1);
+  }
+  catch (const std::out_of_range&) {
+    thrown = true;
+  }
+  CHECK(thrown);
+}
+
+// the counters follow the added, destroyed and cleared blocks
+void TestBlockFieldCounters()
+{
+  BlockField field { 0.0f, 0.0f, 10.0f, 5.0f, 8, 4 };
+  CHECK(field.Size() == 0 && field.LiveCount() == 0);
+  const unsigned generation = field.Generation();
+
+  const std::size_t first = field.Add(0, 0, Sprite::BlockGreen, 10);
+  const std::size_t second = field.Add(2, 1, Sprite::BlockRed, 20);
+  CHECK(field.Size() == 2 && field.LiveCount() == 2);
+  CHECK(field.Points(second) == 20);
+  CHECK(Near(field.Position(second).X(), 25.0f)
+      && Near(field.Position(second).Y(), 7.5f));
+
+  field.Destroy(first);
+  CHECK(field.IsDestroyed(first) && !field.IsDestroyed(second));
+  CHECK(field.Size() == 2 && field.LiveCount() == 1);
+  // the destroyed block is not found any more
+  CHECK(BlocksInArea(field, 0.0f, 0.0f, 80.0f, 20.0f)
+      == std::vector<std::size_t> { second });
+
+  field.Clear();
+  CHECK(field.Size() == 0 && field.LiveCount() == 0);
+  CHECK(field.Generation() != generation);
+  CHECK(BlocksInArea(field, 0.0f, 0.0f, 80.0f, 20.0f).empty());
+}
+
+// ------ EVENTS AND BUFFERS ------//
+// the duplicates of an event are coalesced into the record of its first
+// occurrence
+void TestEventQueueCoalescing()
+{
+  EventQueue queue;
+  CHECK(queue.Empty());
+  queue.Push(GameEvent::WallBounce);
+  queue.Push(GameEvent::BlockDestroyed, 10);
+  queue.Push(GameEvent::WallBounce);
+  queue.Push(GameEvent::BlockDestroyed, 20);
+
+  std::vector<EventRecord> records(queue.begin(), queue.end());
+  CHECK(records.size() == 2);
+  CHECK(records[0].type == GameEvent::WallBounce && records[0].count == 2
+      && records[0].points == 0);
+  CHECK(records[1].type == GameEvent::BlockDestroyed
+      && records[1].count == 2 && records[1].points == 30);
+  CHECK(queue.Contains(GameEvent::WallBounce));
+  CHECK(!queue.Contains(GameEvent::BallLost));
+
+  queue.Clear();
+  CHECK(queue.Empty() && !queue.Contains(GameEvent::WallBounce));
+}
+
+// the reader gets the latest published value and keeps it until a newer one
+void TestTripleBuffer()
+{
+  TripleBuffer<int> buffer;
+  CHECK(!buffer.Update());
+  buffer.WriteBuffer() = 1;
+  buffer.Publish();
+  buffer.WriteBuffer() = 2;
+  buffer.Publish();
+  CHECK(buffer.Update());
+  CHECK(buffer.ReadBuffer() == 2);
+  CHECK(!buffer.Update());
+  CHECK(buffer.ReadBuffer() == 2);
+
+  // values published by another thread are never read out of order
+  constexpr int last = 100000;
+  std::thread writer([&buffer]() {
+    for (int value = 3; value <= last; value++) {
+      buffer.WriteBuffer() = value;
+      buffer.Publish();
+    }
+  });
+  int previous = 2;
+  bool ordered = true;
+  while (previous != last) {
+    if (buffer.Update()) {
+      ordered = ordered && buffer.ReadBuffer() > previous;
+      previous = buffer.ReadBuffer();
+    }
+  }
+  writer.join();
+  CHECK(ordered);
+}
+
+// ------ BATCH RUNS ------//
+// the games give the same results whatever the number of threads
+void TestBatchThreads()
+{
+  BatchSettings settings;
+  settings.games = 8;
+  settings.seed = 1;
+  settings.time_limit = 120.0f;
+  settings.levels_path = ARKANOID_LEVELS_DIR;
+
+  settings.threads = 1;
+  const std::vector<GameResult> single = BatchRunner { settings }.Run();
+  settings.threads = 4;
+  const std::vector<GameResult> multiple = BatchRunner { settings }.Run();
+
+  CHECK(single.size() == settings.games);
+  CHECK(multiple.size() == settings.games);
+  for (std::size_t i = 0; i < single.size() && i < multiple.size(); i++) {
+    CHECK(single[i].seed == settings.seed + i);
+    CHECK(single[i].seed == multiple[i].seed);
+    CHECK(single[i].cleared == multiple[i].cleared);
+    CHECK(single[i].score == multiple[i].score);
+    CHECK(single[i].time == multiple[i].time);
+    CHECK(single[i].balls_lost == multiple[i].balls_lost);
+    CHECK(single[i].bounces == multiple[i].bounces);
+  }
+}
+
+// a test with its name
+struct NamedTest
+{
+  const char* name;
+  std::function<void()> function;
+};
+
+const std::vector<NamedTest> tests {
+  { "SweepHeadOn", TestSweepHeadOn },
+  { "SweepTangent", TestSweepTangent },
+  { "SweepStartOverlapping", TestSweepStartOverlapping },
+  { "SweepCorner", TestSweepCorner },
+  { "NoTunnellingFastBall", TestNoTunnellingFastBall },
+  { "NoTunnellingLongStep", TestNoTunnellingLongStep },
+  { "SchedulerStaleEntries", TestSchedulerStaleEntries },
+  { "SchedulerCompaction", TestSchedulerCompaction },
+  { "BlockGridQueries", TestBlockGridQueries },
+  { "BlockFieldCounters", TestBlockFieldCounters },
+  { "EventQueueCoalescing", TestEventQueueCoalescing },
+  { "TripleBuffer", TestTripleBuffer },
+  { "BatchThreads", TestBatchThreads },
+};
+}
+
+int main(int argc, char const* argv[])
+{
+  unsigned run { 0 };
+  unsigned failed { 0 };
+  for (const auto& test : tests) {
+    if (argc > 1 && std::strcmp(argv[1], test.name) != 0) {
+      continue;
+    }
+    failures = 0;
+    try {
+      test.function();
+    }
+    catch (const std::exception& e) {
+      std::cerr << "unexpected exception: " << e.what() << std::endl;
+      failures++;
+    }
+    std::cout << (failures == 0 ? "passed: " : "FAILED: ") << test.name
+              << std::endl;
+    run++;
+    failed += failures == 0 ? 0 : 1;
+  }
+  if (run == 0) {
+    std::cerr << "Unknown test: " << argv[1] << std::endl;
+    return -1;
+  }
+  return failed == 0 ? 0 : 1;
+}